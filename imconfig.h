@@ -36,6 +36,7 @@
 //#define IMGUI_DISABLE_FORMAT_STRING_FUNCTIONS             // Don't implement ImFormatString/ImFormatStringV so you can implement them yourself if you don't want to link with vsnprintf.
 //#define IMGUI_DISABLE_MATH_FUNCTIONS                      // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 wrapper so you can implement them yourself. Declare your prototypes in imconfig.h.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
+//#define IMGUI_DISABLE_SSE                                 // Don't use SSE2 intrinsics, which are otherwise used on x86/x64 targets supporting them (e.g. to flatten ImDrawData).
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -43,6 +44,14 @@
 //---- Pack colors to BGRA8 instead of RGBA8 (to avoid converting from one to another)
 //#define IMGUI_USE_BGRA_PACKED_COLOR
 
+//---- Use a faster CRC32 implementation for ImHashStr()/ImHashData(), used to compute all IDs. All implementations generate the same IDs.
+//#define IMGUI_USE_CRC32_SLICE_BY_8                        // Process 8 bytes per iteration using 8 lookup tables (8KB instead of 1KB).
+//#define IMGUI_USE_CRC32_HARDWARE                          // Use ARMv8 CRC32 instructions when available (__ARM_FEATURE_CRC32, e.g. -march=armv8-a+crc). Falls back to the table implementation(s) otherwise.
+
+//---- Make ImGuiStorage instances use an open-addressing hash index by default instead of a sorted array (O(1) insertion, useful with thousands of keys per window).
+// You can also enable it on a given storage instance by calling ImGuiStorage::SetHashed(true).
+//#define IMGUI_USE_HASHED_STORAGE
+
 //---- Avoid multiple STB libraries implementations, or redefine path/filenames to prioritize another version
 // By default the embedded implementations are declared static and not available outside of imgui cpp files.
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
@@ -68,6 +77,11 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert layout instead of the default 20 bytes one, to reduce vertex upload bandwidth.
+// Positions are stored as 16-bit fixed-point values with 1/4th of pixel precision (range -8192..+8191, outside values are clamped),
+// texture coordinates as 16-bit normalized values. Your renderer back-end will need to support it (imgui_impl_opengl3.cpp does).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Tip: You can add extra functions within the ImGui:: namespace, here or in your own headers files.
 /*
 namespace ImGui
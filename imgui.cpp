@@ -69,6 +69,7 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
+// [SECTION] ImArena
 // [SECTION] ImGuiListClipper
 // [SECTION] RENDER HELPERS
 // [SECTION] MAIN CODE (most of the code! lots of stuff, needs tidying up!)
@@ -79,6 +80,9 @@ CODE
 // [SECTION] DRAG AND DROP
 // [SECTION] LOGGING/CAPTURING
 // [SECTION] SETTINGS
+// [SECTION] PROFILER
+// [SECTION] ALLOCATION AUDIT
+// [SECTION] MEMORY ACCOUNTING
 // [SECTION] PLATFORM DEPENDENT HELPERS
 // [SECTION] METRICS/DEBUG WINDOW
 
@@ -922,6 +926,9 @@ CODE
       contents behind or over every other imgui windows (one bg/fg drawlist per viewport).
     - You can create your own ImDrawList instance. You'll need to initialize them ImGui::GetDrawListSharedData(), or create
       your own ImDrawListSharedData, and then call your rendered code with your own ImDrawList or ImDrawData data.
+    - You can build your own ImDrawList instances on other threads, using a copy of the shared data made with
+      ImGui::CreateDrawListSharedData(), then submit them from the main thread with ImGui::AddDrawListToWindow() or
+      ImGui::AddDrawListToForeground() (rendered as-is without copying), or copy them with ImDrawList::AddDrawList().
 
  Q: How can I use this without a mouse, without a keyboard or without a screen? (gamepad, input share, remote display)
  A: - You can control Dear ImGui with a gamepad. Read about navigation in "Using gamepad/keyboard navigation controls".
@@ -983,6 +990,9 @@ CODE
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#if defined(IMGUI_USE_CRC32_HARDWARE) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>   // __crc32b, __crc32d
+#endif
 
 // Debug options
 #define IMGUI_DEBUG_NAV_SCORING     0   // Display navigation scoring preview when hovering items. Display last moving direction matches when holding CTRL
@@ -1032,6 +1042,13 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 static const float WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS = 4.0f;     // Extend outside and inside windows. Affect FindHoveredWindow().
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 
+// Deferred tessellation (io.ConfigDeferTessellation)
+static const int   TESSELLATE_JOB_POINTS_MIN                = 1024;     // Deferred primitives of a draw list are split into jobs of at least this number of points
+
+// Idle/event-driven frames (see io.NextFrameTimeout)
+static const int   IDLE_FRAMES_AFTER_INPUT                  = 3;        // Frames rendered after the last input event before allowing to idle, to let hovering, layout and auto-resizing settle.
+static const float IDLE_HOVER_TIMERS_DURATION               = 1.00f;    // Render continuously during the first second of hovering an item, as some visuals depend on hover timers (tooltips, tab stretching, resize borders highlight).
+
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
 //-------------------------------------------------------------------------
@@ -1051,6 +1068,15 @@ static ImRect           GetViewportRect();
 static void*            SettingsHandlerWindow_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name);
 static void             SettingsHandlerWindow_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             SettingsHandlerWindow_WriteAll(ImGuiContext* imgui_ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf);
+static void             ProfilerNewFrame();
+static void             AllocAuditNewFrame();
+static void             AllocAuditRecordAlloc(ImGuiContext* ctx, size_t size);
+static void             MemoryNewFrame();
+static void             MemoryTrackAlloc(ImGuiContext* ctx, void* ptr, size_t size);
+static void             MemoryTrackFree(ImGuiContext* ctx, void* ptr);
+static void             MemoryClearAllocs(ImGuiContext* ctx);
+static void             SettingsHandlerWindow_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, const char* data, const char* data_end);
+static void             SettingsHandlerWindow_WriteBinary(ImGuiContext*, ImGuiSettingsHandler*, ImVector<char>* buf);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
@@ -1077,6 +1103,8 @@ static int              FindWindowFocusIndex(ImGuiWindow* window);
 // Misc
 static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
+static void             UpdateInputEventsThisFrame();
+static void             UpdateNextFrameTimeout();
 static void             UpdateManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4]);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1228,6 +1256,11 @@ ImGuiIO::ImGuiIO()
     ConfigInputTextCursorBlink = true;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
+    ConfigDeferTessellation = false;
+    ConfigFlattenDrawData = false;
+    ConfigMergeDrawCmds = false;
+    ConfigOcclusionCulling = false;
+    ConfigWindowsMemoryCompactTimer = 60.0f;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1237,6 +1270,8 @@ ImGuiIO::ImGuiIO()
     ClipboardUserData = NULL;
     ImeSetInputScreenPosFn = ImeSetInputScreenPosFn_DefaultImpl;
     ImeWindowHandle = NULL;
+    ParallelForFn = NULL;
+    ParallelForUserData = NULL;
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     RenderDrawListsFn = NULL;
@@ -1511,17 +1546,178 @@ static const ImU32 GCrc32LookupTable[256] =
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
 };
 
+#ifdef IMGUI_USE_CRC32_SLICE_BY_8
+// Additional tables for slice-by-8 (7KB). GCrc32LookupTableSlices[k-1][n] is the CRC of byte n followed by k zero bytes.
+// Processing 8 bytes per iteration with independent table lookups generates exactly the same values as the byte-at-a-time loop.
+static const ImU32 GCrc32LookupTableSlices[7][256] =
+{
+    {
+        0x00000000,0x191B3141,0x32366282,0x2B2D53C3,0x646CC504,0x7D77F445,0x565AA786,0x4F4196C7,0xC8D98A08,0xD1C2BB49,0xFAEFE88A,0xE3F4D9CB,0xACB54F0C,0xB5AE7E4D,0x9E832D8E,0x87981CCF,
+        0x4AC21251,0x53D92310,0x78F470D3,0x61EF4192,0x2EAED755,0x37B5E614,0x1C98B5D7,0x05838496,0x821B9859,0x9B00A918,0xB02DFADB,0xA936CB9A,0xE6775D5D,0xFF6C6C1C,0xD4413FDF,0xCD5A0E9E,
+        0x958424A2,0x8C9F15E3,0xA7B24620,0xBEA97761,0xF1E8E1A6,0xE8F3D0E7,0xC3DE8324,0xDAC5B265,0x5D5DAEAA,0x44469FEB,0x6F6BCC28,0x7670FD69,0x39316BAE,0x202A5AEF,0x0B07092C,0x121C386D,
+        0xDF4636F3,0xC65D07B2,0xED705471,0xF46B6530,0xBB2AF3F7,0xA231C2B6,0x891C9175,0x9007A034,0x179FBCFB,0x0E848DBA,0x25A9DE79,0x3CB2EF38,0x73F379FF,0x6AE848BE,0x41C51B7D,0x58DE2A3C,
+        0xF0794F05,0xE9627E44,0xC24F2D87,0xDB541CC6,0x94158A01,0x8D0EBB40,0xA623E883,0xBF38D9C2,0x38A0C50D,0x21BBF44C,0x0A96A78F,0x138D96CE,0x5CCC0009,0x45D73148,0x6EFA628B,0x77E153CA,
+        0xBABB5D54,0xA3A06C15,0x888D3FD6,0x91960E97,0xDED79850,0xC7CCA911,0xECE1FAD2,0xF5FACB93,0x7262D75C,0x6B79E61D,0x4054B5DE,0x594F849F,0x160E1258,0x0F152319,0x243870DA,0x3D23419B,
+        0x65FD6BA7,0x7CE65AE6,0x57CB0925,0x4ED03864,0x0191AEA3,0x188A9FE2,0x33A7CC21,0x2ABCFD60,0xAD24E1AF,0xB43FD0EE,0x9F12832D,0x8609B26C,0xC94824AB,0xD05315EA,0xFB7E4629,0xE2657768,
+        0x2F3F79F6,0x362448B7,0x1D091B74,0x04122A35,0x4B53BCF2,0x52488DB3,0x7965DE70,0x607EEF31,0xE7E6F3FE,0xFEFDC2BF,0xD5D0917C,0xCCCBA03D,0x838A36FA,0x9A9107BB,0xB1BC5478,0xA8A76539,
+        0x3B83984B,0x2298A90A,0x09B5FAC9,0x10AECB88,0x5FEF5D4F,0x46F46C0E,0x6DD93FCD,0x74C20E8C,0xF35A1243,0xEA412302,0xC16C70C1,0xD8774180,0x9736D747,0x8E2DE606,0xA500B5C5,0xBC1B8484,
+        0x71418A1A,0x685ABB5B,0x4377E898,0x5A6CD9D9,0x152D4F1E,0x0C367E5F,0x271B2D9C,0x3E001CDD,0xB9980012,0xA0833153,0x8BAE6290,0x92B553D1,0xDDF4C516,0xC4EFF457,0xEFC2A794,0xF6D996D5,
+        0xAE07BCE9,0xB71C8DA8,0x9C31DE6B,0x852AEF2A,0xCA6B79ED,0xD37048AC,0xF85D1B6F,0xE1462A2E,0x66DE36E1,0x7FC507A0,0x54E85463,0x4DF36522,0x02B2F3E5,0x1BA9C2A4,0x30849167,0x299FA026,
+        0xE4C5AEB8,0xFDDE9FF9,0xD6F3CC3A,0xCFE8FD7B,0x80A96BBC,0x99B25AFD,0xB29F093E,0xAB84387F,0x2C1C24B0,0x350715F1,0x1E2A4632,0x07317773,0x4870E1B4,0x516BD0F5,0x7A468336,0x635DB277,
+        0xCBFAD74E,0xD2E1E60F,0xF9CCB5CC,0xE0D7848D,0xAF96124A,0xB68D230B,0x9DA070C8,0x84BB4189,0x03235D46,0x1A386C07,0x31153FC4,0x280E0E85,0x674F9842,0x7E54A903,0x5579FAC0,0x4C62CB81,
+        0x8138C51F,0x9823F45E,0xB30EA79D,0xAA1596DC,0xE554001B,0xFC4F315A,0xD7626299,0xCE7953D8,0x49E14F17,0x50FA7E56,0x7BD72D95,0x62CC1CD4,0x2D8D8A13,0x3496BB52,0x1FBBE891,0x06A0D9D0,
+        0x5E7EF3EC,0x4765C2AD,0x6C48916E,0x7553A02F,0x3A1236E8,0x230907A9,0x0824546A,0x113F652B,0x96A779E4,0x8FBC48A5,0xA4911B66,0xBD8A2A27,0xF2CBBCE0,0xEBD08DA1,0xC0FDDE62,0xD9E6EF23,
+        0x14BCE1BD,0x0DA7D0FC,0x268A833F,0x3F91B27E,0x70D024B9,0x69CB15F8,0x42E6463B,0x5BFD777A,0xDC656BB5,0xC57E5AF4,0xEE530937,0xF7483876,0xB809AEB1,0xA1129FF0,0x8A3FCC33,0x9324FD72,
+    },
+    {
+        0x00000000,0x01C26A37,0x0384D46E,0x0246BE59,0x0709A8DC,0x06CBC2EB,0x048D7CB2,0x054F1685,0x0E1351B8,0x0FD13B8F,0x0D9785D6,0x0C55EFE1,0x091AF964,0x08D89353,0x0A9E2D0A,0x0B5C473D,
+        0x1C26A370,0x1DE4C947,0x1FA2771E,0x1E601D29,0x1B2F0BAC,0x1AED619B,0x18ABDFC2,0x1969B5F5,0x1235F2C8,0x13F798FF,0x11B126A6,0x10734C91,0x153C5A14,0x14FE3023,0x16B88E7A,0x177AE44D,
+        0x384D46E0,0x398F2CD7,0x3BC9928E,0x3A0BF8B9,0x3F44EE3C,0x3E86840B,0x3CC03A52,0x3D025065,0x365E1758,0x379C7D6F,0x35DAC336,0x3418A901,0x3157BF84,0x3095D5B3,0x32D36BEA,0x331101DD,
+        0x246BE590,0x25A98FA7,0x27EF31FE,0x262D5BC9,0x23624D4C,0x22A0277B,0x20E69922,0x2124F315,0x2A78B428,0x2BBADE1F,0x29FC6046,0x283E0A71,0x2D711CF4,0x2CB376C3,0x2EF5C89A,0x2F37A2AD,
+        0x709A8DC0,0x7158E7F7,0x731E59AE,0x72DC3399,0x7793251C,0x76514F2B,0x7417F172,0x75D59B45,0x7E89DC78,0x7F4BB64F,0x7D0D0816,0x7CCF6221,0x798074A4,0x78421E93,0x7A04A0CA,0x7BC6CAFD,
+        0x6CBC2EB0,0x6D7E4487,0x6F38FADE,0x6EFA90E9,0x6BB5866C,0x6A77EC5B,0x68315202,0x69F33835,0x62AF7F08,0x636D153F,0x612BAB66,0x60E9C151,0x65A6D7D4,0x6464BDE3,0x662203BA,0x67E0698D,
+        0x48D7CB20,0x4915A117,0x4B531F4E,0x4A917579,0x4FDE63FC,0x4E1C09CB,0x4C5AB792,0x4D98DDA5,0x46C49A98,0x4706F0AF,0x45404EF6,0x448224C1,0x41CD3244,0x400F5873,0x4249E62A,0x438B8C1D,
+        0x54F16850,0x55330267,0x5775BC3E,0x56B7D609,0x53F8C08C,0x523AAABB,0x507C14E2,0x51BE7ED5,0x5AE239E8,0x5B2053DF,0x5966ED86,0x58A487B1,0x5DEB9134,0x5C29FB03,0x5E6F455A,0x5FAD2F6D,
+        0xE1351B80,0xE0F771B7,0xE2B1CFEE,0xE373A5D9,0xE63CB35C,0xE7FED96B,0xE5B86732,0xE47A0D05,0xEF264A38,0xEEE4200F,0xECA29E56,0xED60F461,0xE82FE2E4,0xE9ED88D3,0xEBAB368A,0xEA695CBD,
+        0xFD13B8F0,0xFCD1D2C7,0xFE976C9E,0xFF5506A9,0xFA1A102C,0xFBD87A1B,0xF99EC442,0xF85CAE75,0xF300E948,0xF2C2837F,0xF0843D26,0xF1465711,0xF4094194,0xF5CB2BA3,0xF78D95FA,0xF64FFFCD,
+        0xD9785D60,0xD8BA3757,0xDAFC890E,0xDB3EE339,0xDE71F5BC,0xDFB39F8B,0xDDF521D2,0xDC374BE5,0xD76B0CD8,0xD6A966EF,0xD4EFD8B6,0xD52DB281,0xD062A404,0xD1A0CE33,0xD3E6706A,0xD2241A5D,
+        0xC55EFE10,0xC49C9427,0xC6DA2A7E,0xC7184049,0xC25756CC,0xC3953CFB,0xC1D382A2,0xC011E895,0xCB4DAFA8,0xCA8FC59F,0xC8C97BC6,0xC90B11F1,0xCC440774,0xCD866D43,0xCFC0D31A,0xCE02B92D,
+        0x91AF9640,0x906DFC77,0x922B422E,0x93E92819,0x96A63E9C,0x976454AB,0x9522EAF2,0x94E080C5,0x9FBCC7F8,0x9E7EADCF,0x9C381396,0x9DFA79A1,0x98B56F24,0x99770513,0x9B31BB4A,0x9AF3D17D,
+        0x8D893530,0x8C4B5F07,0x8E0DE15E,0x8FCF8B69,0x8A809DEC,0x8B42F7DB,0x89044982,0x88C623B5,0x839A6488,0x82580EBF,0x801EB0E6,0x81DCDAD1,0x8493CC54,0x8551A663,0x8717183A,0x86D5720D,
+        0xA9E2D0A0,0xA820BA97,0xAA6604CE,0xABA46EF9,0xAEEB787C,0xAF29124B,0xAD6FAC12,0xACADC625,0xA7F18118,0xA633EB2F,0xA4755576,0xA5B73F41,0xA0F829C4,0xA13A43F3,0xA37CFDAA,0xA2BE979D,
+        0xB5C473D0,0xB40619E7,0xB640A7BE,0xB782CD89,0xB2CDDB0C,0xB30FB13B,0xB1490F62,0xB08B6555,0xBBD72268,0xBA15485F,0xB853F606,0xB9919C31,0xBCDE8AB4,0xBD1CE083,0xBF5A5EDA,0xBE9834ED,
+    },
+    {
+        0x00000000,0xB8BC6765,0xAA09C88B,0x12B5AFEE,0x8F629757,0x37DEF032,0x256B5FDC,0x9DD738B9,0xC5B428EF,0x7D084F8A,0x6FBDE064,0xD7018701,0x4AD6BFB8,0xF26AD8DD,0xE0DF7733,0x58631056,
+        0x5019579F,0xE8A530FA,0xFA109F14,0x42ACF871,0xDF7BC0C8,0x67C7A7AD,0x75720843,0xCDCE6F26,0x95AD7F70,0x2D111815,0x3FA4B7FB,0x8718D09E,0x1ACFE827,0xA2738F42,0xB0C620AC,0x087A47C9,
+        0xA032AF3E,0x188EC85B,0x0A3B67B5,0xB28700D0,0x2F503869,0x97EC5F0C,0x8559F0E2,0x3DE59787,0x658687D1,0xDD3AE0B4,0xCF8F4F5A,0x7733283F,0xEAE41086,0x525877E3,0x40EDD80D,0xF851BF68,
+        0xF02BF8A1,0x48979FC4,0x5A22302A,0xE29E574F,0x7F496FF6,0xC7F50893,0xD540A77D,0x6DFCC018,0x359FD04E,0x8D23B72B,0x9F9618C5,0x272A7FA0,0xBAFD4719,0x0241207C,0x10F48F92,0xA848E8F7,
+        0x9B14583D,0x23A83F58,0x311D90B6,0x89A1F7D3,0x1476CF6A,0xACCAA80F,0xBE7F07E1,0x06C36084,0x5EA070D2,0xE61C17B7,0xF4A9B859,0x4C15DF3C,0xD1C2E785,0x697E80E0,0x7BCB2F0E,0xC377486B,
+        0xCB0D0FA2,0x73B168C7,0x6104C729,0xD9B8A04C,0x446F98F5,0xFCD3FF90,0xEE66507E,0x56DA371B,0x0EB9274D,0xB6054028,0xA4B0EFC6,0x1C0C88A3,0x81DBB01A,0x3967D77F,0x2BD27891,0x936E1FF4,
+        0x3B26F703,0x839A9066,0x912F3F88,0x299358ED,0xB4446054,0x0CF80731,0x1E4DA8DF,0xA6F1CFBA,0xFE92DFEC,0x462EB889,0x549B1767,0xEC277002,0x71F048BB,0xC94C2FDE,0xDBF98030,0x6345E755,
+        0x6B3FA09C,0xD383C7F9,0xC1366817,0x798A0F72,0xE45D37CB,0x5CE150AE,0x4E54FF40,0xF6E89825,0xAE8B8873,0x1637EF16,0x048240F8,0xBC3E279D,0x21E91F24,0x99557841,0x8BE0D7AF,0x335CB0CA,
+        0xED59B63B,0x55E5D15E,0x47507EB0,0xFFEC19D5,0x623B216C,0xDA874609,0xC832E9E7,0x708E8E82,0x28ED9ED4,0x9051F9B1,0x82E4565F,0x3A58313A,0xA78F0983,0x1F336EE6,0x0D86C108,0xB53AA66D,
+        0xBD40E1A4,0x05FC86C1,0x1749292F,0xAFF54E4A,0x322276F3,0x8A9E1196,0x982BBE78,0x2097D91D,0x78F4C94B,0xC048AE2E,0xD2FD01C0,0x6A4166A5,0xF7965E1C,0x4F2A3979,0x5D9F9697,0xE523F1F2,
+        0x4D6B1905,0xF5D77E60,0xE762D18E,0x5FDEB6EB,0xC2098E52,0x7AB5E937,0x680046D9,0xD0BC21BC,0x88DF31EA,0x3063568F,0x22D6F961,0x9A6A9E04,0x07BDA6BD,0xBF01C1D8,0xADB46E36,0x15080953,
+        0x1D724E9A,0xA5CE29FF,0xB77B8611,0x0FC7E174,0x9210D9CD,0x2AACBEA8,0x38191146,0x80A57623,0xD8C66675,0x607A0110,0x72CFAEFE,0xCA73C99B,0x57A4F122,0xEF189647,0xFDAD39A9,0x45115ECC,
+        0x764DEE06,0xCEF18963,0xDC44268D,0x64F841E8,0xF92F7951,0x41931E34,0x5326B1DA,0xEB9AD6BF,0xB3F9C6E9,0x0B45A18C,0x19F00E62,0xA14C6907,0x3C9B51BE,0x842736DB,0x96929935,0x2E2EFE50,
+        0x2654B999,0x9EE8DEFC,0x8C5D7112,0x34E11677,0xA9362ECE,0x118A49AB,0x033FE645,0xBB838120,0xE3E09176,0x5B5CF613,0x49E959FD,0xF1553E98,0x6C820621,0xD43E6144,0xC68BCEAA,0x7E37A9CF,
+        0xD67F4138,0x6EC3265D,0x7C7689B3,0xC4CAEED6,0x591DD66F,0xE1A1B10A,0xF3141EE4,0x4BA87981,0x13CB69D7,0xAB770EB2,0xB9C2A15C,0x017EC639,0x9CA9FE80,0x241599E5,0x36A0360B,0x8E1C516E,
+        0x866616A7,0x3EDA71C2,0x2C6FDE2C,0x94D3B949,0x090481F0,0xB1B8E695,0xA30D497B,0x1BB12E1E,0x43D23E48,0xFB6E592D,0xE9DBF6C3,0x516791A6,0xCCB0A91F,0x740CCE7A,0x66B96194,0xDE0506F1,
+    },
+    {
+        0x00000000,0x3D6029B0,0x7AC05360,0x47A07AD0,0xF580A6C0,0xC8E08F70,0x8F40F5A0,0xB220DC10,0x30704BC1,0x0D106271,0x4AB018A1,0x77D03111,0xC5F0ED01,0xF890C4B1,0xBF30BE61,0x825097D1,
+        0x60E09782,0x5D80BE32,0x1A20C4E2,0x2740ED52,0x95603142,0xA80018F2,0xEFA06222,0xD2C04B92,0x5090DC43,0x6DF0F5F3,0x2A508F23,0x1730A693,0xA5107A83,0x98705333,0xDFD029E3,0xE2B00053,
+        0xC1C12F04,0xFCA106B4,0xBB017C64,0x866155D4,0x344189C4,0x0921A074,0x4E81DAA4,0x73E1F314,0xF1B164C5,0xCCD14D75,0x8B7137A5,0xB6111E15,0x0431C205,0x3951EBB5,0x7EF19165,0x4391B8D5,
+        0xA121B886,0x9C419136,0xDBE1EBE6,0xE681C256,0x54A11E46,0x69C137F6,0x2E614D26,0x13016496,0x9151F347,0xAC31DAF7,0xEB91A027,0xD6F18997,0x64D15587,0x59B17C37,0x1E1106E7,0x23712F57,
+        0x58F35849,0x659371F9,0x22330B29,0x1F532299,0xAD73FE89,0x9013D739,0xD7B3ADE9,0xEAD38459,0x68831388,0x55E33A38,0x124340E8,0x2F236958,0x9D03B548,0xA0639CF8,0xE7C3E628,0xDAA3CF98,
+        0x3813CFCB,0x0573E67B,0x42D39CAB,0x7FB3B51B,0xCD93690B,0xF0F340BB,0xB7533A6B,0x8A3313DB,0x0863840A,0x3503ADBA,0x72A3D76A,0x4FC3FEDA,0xFDE322CA,0xC0830B7A,0x872371AA,0xBA43581A,
+        0x9932774D,0xA4525EFD,0xE3F2242D,0xDE920D9D,0x6CB2D18D,0x51D2F83D,0x167282ED,0x2B12AB5D,0xA9423C8C,0x9422153C,0xD3826FEC,0xEEE2465C,0x5CC29A4C,0x61A2B3FC,0x2602C92C,0x1B62E09C,
+        0xF9D2E0CF,0xC4B2C97F,0x8312B3AF,0xBE729A1F,0x0C52460F,0x31326FBF,0x7692156F,0x4BF23CDF,0xC9A2AB0E,0xF4C282BE,0xB362F86E,0x8E02D1DE,0x3C220DCE,0x0142247E,0x46E25EAE,0x7B82771E,
+        0xB1E6B092,0x8C869922,0xCB26E3F2,0xF646CA42,0x44661652,0x79063FE2,0x3EA64532,0x03C66C82,0x8196FB53,0xBCF6D2E3,0xFB56A833,0xC6368183,0x74165D93,0x49767423,0x0ED60EF3,0x33B62743,
+        0xD1062710,0xEC660EA0,0xABC67470,0x96A65DC0,0x248681D0,0x19E6A860,0x5E46D2B0,0x6326FB00,0xE1766CD1,0xDC164561,0x9BB63FB1,0xA6D61601,0x14F6CA11,0x2996E3A1,0x6E369971,0x5356B0C1,
+        0x70279F96,0x4D47B626,0x0AE7CCF6,0x3787E546,0x85A73956,0xB8C710E6,0xFF676A36,0xC2074386,0x4057D457,0x7D37FDE7,0x3A978737,0x07F7AE87,0xB5D77297,0x88B75B27,0xCF1721F7,0xF2770847,
+        0x10C70814,0x2DA721A4,0x6A075B74,0x576772C4,0xE547AED4,0xD8278764,0x9F87FDB4,0xA2E7D404,0x20B743D5,0x1DD76A65,0x5A7710B5,0x67173905,0xD537E515,0xE857CCA5,0xAFF7B675,0x92979FC5,
+        0xE915E8DB,0xD475C16B,0x93D5BBBB,0xAEB5920B,0x1C954E1B,0x21F567AB,0x66551D7B,0x5B3534CB,0xD965A31A,0xE4058AAA,0xA3A5F07A,0x9EC5D9CA,0x2CE505DA,0x11852C6A,0x562556BA,0x6B457F0A,
+        0x89F57F59,0xB49556E9,0xF3352C39,0xCE550589,0x7C75D999,0x4115F029,0x06B58AF9,0x3BD5A349,0xB9853498,0x84E51D28,0xC34567F8,0xFE254E48,0x4C059258,0x7165BBE8,0x36C5C138,0x0BA5E888,
+        0x28D4C7DF,0x15B4EE6F,0x521494BF,0x6F74BD0F,0xDD54611F,0xE03448AF,0xA794327F,0x9AF41BCF,0x18A48C1E,0x25C4A5AE,0x6264DF7E,0x5F04F6CE,0xED242ADE,0xD044036E,0x97E479BE,0xAA84500E,
+        0x4834505D,0x755479ED,0x32F4033D,0x0F942A8D,0xBDB4F69D,0x80D4DF2D,0xC774A5FD,0xFA148C4D,0x78441B9C,0x4524322C,0x028448FC,0x3FE4614C,0x8DC4BD5C,0xB0A494EC,0xF704EE3C,0xCA64C78C,
+    },
+    {
+        0x00000000,0xCB5CD3A5,0x4DC8A10B,0x869472AE,0x9B914216,0x50CD91B3,0xD659E31D,0x1D0530B8,0xEC53826D,0x270F51C8,0xA19B2366,0x6AC7F0C3,0x77C2C07B,0xBC9E13DE,0x3A0A6170,0xF156B2D5,
+        0x03D6029B,0xC88AD13E,0x4E1EA390,0x85427035,0x9847408D,0x531B9328,0xD58FE186,0x1ED33223,0xEF8580F6,0x24D95353,0xA24D21FD,0x6911F258,0x7414C2E0,0xBF481145,0x39DC63EB,0xF280B04E,
+        0x07AC0536,0xCCF0D693,0x4A64A43D,0x81387798,0x9C3D4720,0x57619485,0xD1F5E62B,0x1AA9358E,0xEBFF875B,0x20A354FE,0xA6372650,0x6D6BF5F5,0x706EC54D,0xBB3216E8,0x3DA66446,0xF6FAB7E3,
+        0x047A07AD,0xCF26D408,0x49B2A6A6,0x82EE7503,0x9FEB45BB,0x54B7961E,0xD223E4B0,0x197F3715,0xE82985C0,0x23755665,0xA5E124CB,0x6EBDF76E,0x73B8C7D6,0xB8E41473,0x3E7066DD,0xF52CB578,
+        0x0F580A6C,0xC404D9C9,0x4290AB67,0x89CC78C2,0x94C9487A,0x5F959BDF,0xD901E971,0x125D3AD4,0xE30B8801,0x28575BA4,0xAEC3290A,0x659FFAAF,0x789ACA17,0xB3C619B2,0x35526B1C,0xFE0EB8B9,
+        0x0C8E08F7,0xC7D2DB52,0x4146A9FC,0x8A1A7A59,0x971F4AE1,0x5C439944,0xDAD7EBEA,0x118B384F,0xE0DD8A9A,0x2B81593F,0xAD152B91,0x6649F834,0x7B4CC88C,0xB0101B29,0x36846987,0xFDD8BA22,
+        0x08F40F5A,0xC3A8DCFF,0x453CAE51,0x8E607DF4,0x93654D4C,0x58399EE9,0xDEADEC47,0x15F13FE2,0xE4A78D37,0x2FFB5E92,0xA96F2C3C,0x6233FF99,0x7F36CF21,0xB46A1C84,0x32FE6E2A,0xF9A2BD8F,
+        0x0B220DC1,0xC07EDE64,0x46EAACCA,0x8DB67F6F,0x90B34FD7,0x5BEF9C72,0xDD7BEEDC,0x16273D79,0xE7718FAC,0x2C2D5C09,0xAAB92EA7,0x61E5FD02,0x7CE0CDBA,0xB7BC1E1F,0x31286CB1,0xFA74BF14,
+        0x1EB014D8,0xD5ECC77D,0x5378B5D3,0x98246676,0x852156CE,0x4E7D856B,0xC8E9F7C5,0x03B52460,0xF2E396B5,0x39BF4510,0xBF2B37BE,0x7477E41B,0x6972D4A3,0xA22E0706,0x24BA75A8,0xEFE6A60D,
+        0x1D661643,0xD63AC5E6,0x50AEB748,0x9BF264ED,0x86F75455,0x4DAB87F0,0xCB3FF55E,0x006326FB,0xF135942E,0x3A69478B,0xBCFD3525,0x77A1E680,0x6AA4D638,0xA1F8059D,0x276C7733,0xEC30A496,
+        0x191C11EE,0xD240C24B,0x54D4B0E5,0x9F886340,0x828D53F8,0x49D1805D,0xCF45F2F3,0x04192156,0xF54F9383,0x3E134026,0xB8873288,0x73DBE12D,0x6EDED195,0xA5820230,0x2316709E,0xE84AA33B,
+        0x1ACA1375,0xD196C0D0,0x5702B27E,0x9C5E61DB,0x815B5163,0x4A0782C6,0xCC93F068,0x07CF23CD,0xF6999118,0x3DC542BD,0xBB513013,0x700DE3B6,0x6D08D30E,0xA65400AB,0x20C07205,0xEB9CA1A0,
+        0x11E81EB4,0xDAB4CD11,0x5C20BFBF,0x977C6C1A,0x8A795CA2,0x41258F07,0xC7B1FDA9,0x0CED2E0C,0xFDBB9CD9,0x36E74F7C,0xB0733DD2,0x7B2FEE77,0x662ADECF,0xAD760D6A,0x2BE27FC4,0xE0BEAC61,
+        0x123E1C2F,0xD962CF8A,0x5FF6BD24,0x94AA6E81,0x89AF5E39,0x42F38D9C,0xC467FF32,0x0F3B2C97,0xFE6D9E42,0x35314DE7,0xB3A53F49,0x78F9ECEC,0x65FCDC54,0xAEA00FF1,0x28347D5F,0xE368AEFA,
+        0x16441B82,0xDD18C827,0x5B8CBA89,0x90D0692C,0x8DD55994,0x46898A31,0xC01DF89F,0x0B412B3A,0xFA1799EF,0x314B4A4A,0xB7DF38E4,0x7C83EB41,0x6186DBF9,0xAADA085C,0x2C4E7AF2,0xE712A957,
+        0x15921919,0xDECECABC,0x585AB812,0x93066BB7,0x8E035B0F,0x455F88AA,0xC3CBFA04,0x089729A1,0xF9C19B74,0x329D48D1,0xB4093A7F,0x7F55E9DA,0x6250D962,0xA90C0AC7,0x2F987869,0xE4C4ABCC,
+    },
+    {
+        0x00000000,0xA6770BB4,0x979F1129,0x31E81A9D,0xF44F2413,0x52382FA7,0x63D0353A,0xC5A73E8E,0x33EF4E67,0x959845D3,0xA4705F4E,0x020754FA,0xC7A06A74,0x61D761C0,0x503F7B5D,0xF64870E9,
+        0x67DE9CCE,0xC1A9977A,0xF0418DE7,0x56368653,0x9391B8DD,0x35E6B369,0x040EA9F4,0xA279A240,0x5431D2A9,0xF246D91D,0xC3AEC380,0x65D9C834,0xA07EF6BA,0x0609FD0E,0x37E1E793,0x9196EC27,
+        0xCFBD399C,0x69CA3228,0x582228B5,0xFE552301,0x3BF21D8F,0x9D85163B,0xAC6D0CA6,0x0A1A0712,0xFC5277FB,0x5A257C4F,0x6BCD66D2,0xCDBA6D66,0x081D53E8,0xAE6A585C,0x9F8242C1,0x39F54975,
+        0xA863A552,0x0E14AEE6,0x3FFCB47B,0x998BBFCF,0x5C2C8141,0xFA5B8AF5,0xCBB39068,0x6DC49BDC,0x9B8CEB35,0x3DFBE081,0x0C13FA1C,0xAA64F1A8,0x6FC3CF26,0xC9B4C492,0xF85CDE0F,0x5E2BD5BB,
+        0x440B7579,0xE27C7ECD,0xD3946450,0x75E36FE4,0xB044516A,0x16335ADE,0x27DB4043,0x81AC4BF7,0x77E43B1E,0xD19330AA,0xE07B2A37,0x460C2183,0x83AB1F0D,0x25DC14B9,0x14340E24,0xB2430590,
+        0x23D5E9B7,0x85A2E203,0xB44AF89E,0x123DF32A,0xD79ACDA4,0x71EDC610,0x4005DC8D,0xE672D739,0x103AA7D0,0xB64DAC64,0x87A5B6F9,0x21D2BD4D,0xE47583C3,0x42028877,0x73EA92EA,0xD59D995E,
+        0x8BB64CE5,0x2DC14751,0x1C295DCC,0xBA5E5678,0x7FF968F6,0xD98E6342,0xE86679DF,0x4E11726B,0xB8590282,0x1E2E0936,0x2FC613AB,0x89B1181F,0x4C162691,0xEA612D25,0xDB8937B8,0x7DFE3C0C,
+        0xEC68D02B,0x4A1FDB9F,0x7BF7C102,0xDD80CAB6,0x1827F438,0xBE50FF8C,0x8FB8E511,0x29CFEEA5,0xDF879E4C,0x79F095F8,0x48188F65,0xEE6F84D1,0x2BC8BA5F,0x8DBFB1EB,0xBC57AB76,0x1A20A0C2,
+        0x8816EAF2,0x2E61E146,0x1F89FBDB,0xB9FEF06F,0x7C59CEE1,0xDA2EC555,0xEBC6DFC8,0x4DB1D47C,0xBBF9A495,0x1D8EAF21,0x2C66B5BC,0x8A11BE08,0x4FB68086,0xE9C18B32,0xD82991AF,0x7E5E9A1B,
+        0xEFC8763C,0x49BF7D88,0x78576715,0xDE206CA1,0x1B87522F,0xBDF0599B,0x8C184306,0x2A6F48B2,0xDC27385B,0x7A5033EF,0x4BB82972,0xEDCF22C6,0x28681C48,0x8E1F17FC,0xBFF70D61,0x198006D5,
+        0x47ABD36E,0xE1DCD8DA,0xD034C247,0x7643C9F3,0xB3E4F77D,0x1593FCC9,0x247BE654,0x820CEDE0,0x74449D09,0xD23396BD,0xE3DB8C20,0x45AC8794,0x800BB91A,0x267CB2AE,0x1794A833,0xB1E3A387,
+        0x20754FA0,0x86024414,0xB7EA5E89,0x119D553D,0xD43A6BB3,0x724D6007,0x43A57A9A,0xE5D2712E,0x139A01C7,0xB5ED0A73,0x840510EE,0x22721B5A,0xE7D525D4,0x41A22E60,0x704A34FD,0xD63D3F49,
+        0xCC1D9F8B,0x6A6A943F,0x5B828EA2,0xFDF58516,0x3852BB98,0x9E25B02C,0xAFCDAAB1,0x09BAA105,0xFFF2D1EC,0x5985DA58,0x686DC0C5,0xCE1ACB71,0x0BBDF5FF,0xADCAFE4B,0x9C22E4D6,0x3A55EF62,
+        0xABC30345,0x0DB408F1,0x3C5C126C,0x9A2B19D8,0x5F8C2756,0xF9FB2CE2,0xC813367F,0x6E643DCB,0x982C4D22,0x3E5B4696,0x0FB35C0B,0xA9C457BF,0x6C636931,0xCA146285,0xFBFC7818,0x5D8B73AC,
+        0x03A0A617,0xA5D7ADA3,0x943FB73E,0x3248BC8A,0xF7EF8204,0x519889B0,0x6070932D,0xC6079899,0x304FE870,0x9638E3C4,0xA7D0F959,0x01A7F2ED,0xC400CC63,0x6277C7D7,0x539FDD4A,0xF5E8D6FE,
+        0x647E3AD9,0xC209316D,0xF3E12BF0,0x55962044,0x90311ECA,0x3646157E,0x07AE0FE3,0xA1D90457,0x579174BE,0xF1E67F0A,0xC00E6597,0x66796E23,0xA3DE50AD,0x05A95B19,0x34414184,0x92364A30,
+    },
+    {
+        0x00000000,0xCCAA009E,0x4225077D,0x8E8F07E3,0x844A0EFA,0x48E00E64,0xC66F0987,0x0AC50919,0xD3E51BB5,0x1F4F1B2B,0x91C01CC8,0x5D6A1C56,0x57AF154F,0x9B0515D1,0x158A1232,0xD92012AC,
+        0x7CBB312B,0xB01131B5,0x3E9E3656,0xF23436C8,0xF8F13FD1,0x345B3F4F,0xBAD438AC,0x767E3832,0xAF5E2A9E,0x63F42A00,0xED7B2DE3,0x21D12D7D,0x2B142464,0xE7BE24FA,0x69312319,0xA59B2387,
+        0xF9766256,0x35DC62C8,0xBB53652B,0x77F965B5,0x7D3C6CAC,0xB1966C32,0x3F196BD1,0xF3B36B4F,0x2A9379E3,0xE639797D,0x68B67E9E,0xA41C7E00,0xAED97719,0x62737787,0xECFC7064,0x205670FA,
+        0x85CD537D,0x496753E3,0xC7E85400,0x0B42549E,0x01875D87,0xCD2D5D19,0x43A25AFA,0x8F085A64,0x562848C8,0x9A824856,0x140D4FB5,0xD8A74F2B,0xD2624632,0x1EC846AC,0x9047414F,0x5CED41D1,
+        0x299DC2ED,0xE537C273,0x6BB8C590,0xA712C50E,0xADD7CC17,0x617DCC89,0xEFF2CB6A,0x2358CBF4,0xFA78D958,0x36D2D9C6,0xB85DDE25,0x74F7DEBB,0x7E32D7A2,0xB298D73C,0x3C17D0DF,0xF0BDD041,
+        0x5526F3C6,0x998CF358,0x1703F4BB,0xDBA9F425,0xD16CFD3C,0x1DC6FDA2,0x9349FA41,0x5FE3FADF,0x86C3E873,0x4A69E8ED,0xC4E6EF0E,0x084CEF90,0x0289E689,0xCE23E617,0x40ACE1F4,0x8C06E16A,
+        0xD0EBA0BB,0x1C41A025,0x92CEA7C6,0x5E64A758,0x54A1AE41,0x980BAEDF,0x1684A93C,0xDA2EA9A2,0x030EBB0E,0xCFA4BB90,0x412BBC73,0x8D81BCED,0x8744B5F4,0x4BEEB56A,0xC561B289,0x09CBB217,
+        0xAC509190,0x60FA910E,0xEE7596ED,0x22DF9673,0x281A9F6A,0xE4B09FF4,0x6A3F9817,0xA6959889,0x7FB58A25,0xB31F8ABB,0x3D908D58,0xF13A8DC6,0xFBFF84DF,0x37558441,0xB9DA83A2,0x7570833C,
+        0x533B85DA,0x9F918544,0x111E82A7,0xDDB48239,0xD7718B20,0x1BDB8BBE,0x95548C5D,0x59FE8CC3,0x80DE9E6F,0x4C749EF1,0xC2FB9912,0x0E51998C,0x04949095,0xC83E900B,0x46B197E8,0x8A1B9776,
+        0x2F80B4F1,0xE32AB46F,0x6DA5B38C,0xA10FB312,0xABCABA0B,0x6760BA95,0xE9EFBD76,0x2545BDE8,0xFC65AF44,0x30CFAFDA,0xBE40A839,0x72EAA8A7,0x782FA1BE,0xB485A120,0x3A0AA6C3,0xF6A0A65D,
+        0xAA4DE78C,0x66E7E712,0xE868E0F1,0x24C2E06F,0x2E07E976,0xE2ADE9E8,0x6C22EE0B,0xA088EE95,0x79A8FC39,0xB502FCA7,0x3B8DFB44,0xF727FBDA,0xFDE2F2C3,0x3148F25D,0xBFC7F5BE,0x736DF520,
+        0xD6F6D6A7,0x1A5CD639,0x94D3D1DA,0x5879D144,0x52BCD85D,0x9E16D8C3,0x1099DF20,0xDC33DFBE,0x0513CD12,0xC9B9CD8C,0x4736CA6F,0x8B9CCAF1,0x8159C3E8,0x4DF3C376,0xC37CC495,0x0FD6C40B,
+        0x7AA64737,0xB60C47A9,0x3883404A,0xF42940D4,0xFEEC49CD,0x32464953,0xBCC94EB0,0x70634E2E,0xA9435C82,0x65E95C1C,0xEB665BFF,0x27CC5B61,0x2D095278,0xE1A352E6,0x6F2C5505,0xA386559B,
+        0x061D761C,0xCAB77682,0x44387161,0x889271FF,0x825778E6,0x4EFD7878,0xC0727F9B,0x0CD87F05,0xD5F86DA9,0x19526D37,0x97DD6AD4,0x5B776A4A,0x51B26353,0x9D1863CD,0x1397642E,0xDF3D64B0,
+        0x83D02561,0x4F7A25FF,0xC1F5221C,0x0D5F2282,0x079A2B9B,0xCB302B05,0x45BF2CE6,0x89152C78,0x50353ED4,0x9C9F3E4A,0x121039A9,0xDEBA3937,0xD47F302E,0x18D530B0,0x965A3753,0x5AF037CD,
+        0xFF6B144A,0x33C114D4,0xBD4E1337,0x71E413A9,0x7B211AB0,0xB78B1A2E,0x39041DCD,0xF5AE1D53,0x2C8E0FFF,0xE0240F61,0x6EAB0882,0xA201081C,0xA8C40105,0x646E019B,0xEAE10678,0x264B06E6,
+    },
+};
+#endif
+
+// Hash a span of bytes (no ### handling). The selected implementation is decided by IMGUI_USE_CRC32_XXX in imconfig.h, all of them generate the same values.
+// - IMGUI_USE_CRC32_HARDWARE + __ARM_FEATURE_CRC32: ARMv8 CRC32 instructions (same polynomial as our table).
+// - IMGUI_USE_CRC32_SLICE_BY_8: 8 bytes per iteration using 8 tables.
+// - Default: 1 byte per iteration using a single 1KB table.
+// Note that x86 SSE 4.2 'crc32' instructions use the Castagnoli polynomial (CRC32-C) and would generate different IDs, so we don't use them.
+static inline ImU32 ImHashCrc32Span(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+#if defined(IMGUI_USE_CRC32_HARDWARE) && defined(__ARM_FEATURE_CRC32)
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v = (ImU64)data[0] | ((ImU64)data[1] << 8) | ((ImU64)data[2] << 16) | ((ImU64)data[3] << 24) | ((ImU64)data[4] << 32) | ((ImU64)data[5] << 40) | ((ImU64)data[6] << 48) | ((ImU64)data[7] << 56);
+        crc = __crc32d(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = __crc32b(crc, *data++);
+#else
+    const ImU32* crc32_lut = GCrc32LookupTable;
+#ifdef IMGUI_USE_CRC32_SLICE_BY_8
+    const ImU32 (*crc32_luts)[256] = GCrc32LookupTableSlices;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU32 v = crc ^ ((ImU32)data[0] | ((ImU32)data[1] << 8) | ((ImU32)data[2] << 16) | ((ImU32)data[3] << 24));
+        crc = crc32_luts[6][v & 0xFF] ^ crc32_luts[5][(v >> 8) & 0xFF] ^ crc32_luts[4][(v >> 16) & 0xFF] ^ crc32_luts[3][v >> 24] ^
+              crc32_luts[2][data[4]] ^ crc32_luts[1][data[5]] ^ crc32_luts[0][data[6]] ^ crc32_lut[data[7]];
+    }
+#endif
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
+#endif
+    return crc;
+}
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
-    ImU32 crc = ~seed;
-    const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
-    while (data_size-- != 0)
-        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
-    return ~crc;
+    return ~ImHashCrc32Span(~seed, (const unsigned char*)data_p, data_size);
 }
 
 // Zero-terminated string hash, with support for ### to reset back to seed value
@@ -1529,12 +1725,29 @@ ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
+// - With a multi-bytes CRC32 implementation we hash spans between '#' characters in bulk, and only handle '#' one byte at a time.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#if defined(IMGUI_USE_CRC32_SLICE_BY_8) || (defined(IMGUI_USE_CRC32_HARDWARE) && defined(__ARM_FEATURE_CRC32))
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const unsigned char* data_end = data + data_size;
+    while (data < data_end)
+    {
+        const unsigned char* span_end = (const unsigned char*)memchr(data, '#', (size_t)(data_end - data));
+        if (span_end == NULL)
+            return ~ImHashCrc32Span(crc, data, (size_t)(data_end - data));
+        crc = ImHashCrc32Span(crc, data, (size_t)(span_end - data));
+        data = span_end + 1;
+        if (data_end - data >= 2 && data[0] == '#' && data[1] == '#')
+            crc = seed;
+        crc = ImHashCrc32Span(crc, span_end, 1);
+    }
+#else
     const ImU32* crc32_lut = GCrc32LookupTable;
     if (data_size != 0)
     {
@@ -1555,6 +1768,7 @@ ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
             crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
         }
     }
+#endif
     return ~crc;
 }
 
@@ -1935,6 +2149,77 @@ static ImGuiStorage::Pair* LowerBound(ImVector<ImGuiStorage::Pair>& data, ImGuiI
     return first;
 }
 
+// [Hashed mode] Keys are generally already hashed but user may store sequential keys, so we scramble them a little.
+static inline ImU32 StorageHashKey(ImGuiID key)
+{
+    ImU32 h = key * 0x9E3779B1;
+    return h ^ (h >> 16);
+}
+
+// [Hashed mode] Linear probing. Return slot holding 'key', or the empty slot where it would be inserted.
+static int StorageHashFindSlot(const ImGuiStorage* storage, ImGuiID key)
+{
+    const ImU32 mask = (ImU32)storage->HashIndex.Size - 1;
+    const int* slots = storage->HashIndex.Data;
+    for (ImU32 slot = StorageHashKey(key) & mask; ; slot = (slot + 1) & mask)
+        if (slots[slot] == -1 || storage->Data.Data[slots[slot]].key == key)
+            return (int)slot;
+}
+
+// [Hashed mode] Rebuild index with at least 2x more slots than pairs (load factor <= 0.5)
+static void StorageHashRebuild(ImGuiStorage* storage, int min_pairs_count)
+{
+    int slots_count = 16;
+    while (slots_count < min_pairs_count * 2)
+        slots_count <<= 1;
+    storage->HashIndex.resize(slots_count);
+    memset(storage->HashIndex.Data, 0xFF, (size_t)slots_count * sizeof(int));
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        int slot = StorageHashFindSlot(storage, storage->Data[n].key);
+        IM_ASSERT(storage->HashIndex[slot] == -1 && "Duplicate key in ImGuiStorage!");
+        storage->HashIndex[slot] = n;
+    }
+}
+
+static ImGuiStorage::Pair* StorageFindPair(ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->Hashed)
+    {
+        if (storage->HashIndex.Size == 0)
+            return NULL;
+        int idx = storage->HashIndex[StorageHashFindSlot(storage, key)];
+        return (idx != -1) ? &storage->Data[idx] : NULL;
+    }
+    ImGuiStorage::Pair* it = LowerBound(storage->Data, key);
+    if (it == storage->Data.end() || it->key != key)
+        return NULL;
+    return it;
+}
+
+// Caller is responsible for verifying that the key doesn't exist yet.
+static ImGuiStorage::Pair* StorageInsertPair(ImGuiStorage* storage, const ImGuiStorage::Pair& pair)
+{
+    if (storage->Hashed)
+    {
+        if ((storage->Data.Size + 1) * 2 > storage->HashIndex.Size)
+            StorageHashRebuild(storage, storage->Data.Size + 1);
+        storage->HashIndex[StorageHashFindSlot(storage, pair.key)] = storage->Data.Size;
+        storage->Data.push_back(pair);
+        return &storage->Data.back();
+    }
+    return storage->Data.insert(LowerBound(storage->Data, pair.key), pair);
+}
+
+void ImGuiStorage::SetHashed(bool hashed)
+{
+    if (Hashed == hashed)
+        return;
+    Hashed = hashed;
+    HashIndex.clear();
+    BuildSortByKey();
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -1948,16 +2233,52 @@ void ImGuiStorage::BuildSortByKey()
             return 0;
         }
     };
-    if (Data.Size > 1)
+    if (Hashed)
+        StorageHashRebuild(this, Data.Size);
+    else if (Data.Size > 1)
         ImQsort(Data.Data, (size_t)Data.Size, sizeof(Pair), StaticFunc::PairCompareByID);
 }
 
+// In hashed mode we use backward-shift deletion so we never need tombstones, and swap the last pair into the hole in Data[].
+void ImGuiStorage::Remove(ImGuiID key)
+{
+    if (!Hashed)
+    {
+        ImGuiStorage::Pair* it = LowerBound(Data, key);
+        if (it != Data.end() && it->key == key)
+            Data.erase(it);
+        return;
+    }
+    if (HashIndex.Size == 0)
+        return;
+    int hole = StorageHashFindSlot(this, key);
+    const int idx = HashIndex[hole];
+    if (idx == -1)
+        return;
+    const ImU32 mask = (ImU32)HashIndex.Size - 1;
+    for (ImU32 slot = ((ImU32)hole + 1) & mask; HashIndex[slot] != -1; slot = (slot + 1) & mask)
+    {
+        // Move entry into the hole unless its ideal slot lies cyclically in (hole, slot]
+        const ImU32 ideal = StorageHashKey(Data[HashIndex[slot]].key) & mask;
+        if (((slot - ideal) & mask) >= ((slot - (ImU32)hole) & mask))
+        {
+            HashIndex[hole] = HashIndex[slot];
+            hole = (int)slot;
+        }
+    }
+    HashIndex[hole] = -1;
+    if (idx != Data.Size - 1)
+    {
+        Data[idx] = Data.back();
+        HashIndex[StorageHashFindSlot(this, Data[idx].key)] = idx;
+    }
+    Data.pop_back();
+}
+
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStorage::Pair* it = LowerBound(const_cast<ImVector<ImGuiStorage::Pair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStorage::Pair* it = StorageFindPair(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -1967,26 +2288,22 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStorage::Pair* it = LowerBound(const_cast<ImVector<ImGuiStorage::Pair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStorage::Pair* it = StorageFindPair(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStorage::Pair* it = LowerBound(const_cast<ImVector<ImGuiStorage::Pair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStorage::Pair* it = StorageFindPair(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, Pair(key, default_val));
+    ImGuiStorage::Pair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageInsertPair(this, Pair(key, default_val));
     return &it->val_i;
 }
 
@@ -1997,30 +2314,27 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, Pair(key, default_val));
+    ImGuiStorage::Pair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageInsertPair(this, Pair(key, default_val));
     return &it->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, Pair(key, default_val));
+    ImGuiStorage::Pair* it = StorageFindPair(this, key);
+    if (it == NULL)
+        it = StorageInsertPair(this, Pair(key, default_val));
     return &it->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, Pair(key, val));
-        return;
-    }
-    it->val_i = val;
+    if (ImGuiStorage::Pair* it = StorageFindPair(this, key))
+        it->val_i = val;
+    else
+        StorageInsertPair(this, Pair(key, val));
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2030,24 +2344,18 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, Pair(key, val));
-        return;
-    }
-    it->val_f = val;
+    if (ImGuiStorage::Pair* it = StorageFindPair(this, key))
+        it->val_f = val;
+    else
+        StorageInsertPair(this, Pair(key, val));
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, Pair(key, val));
-        return;
-    }
-    it->val_p = val;
+    if (ImGuiStorage::Pair* it = StorageFindPair(this, key))
+        it->val_p = val;
+    else
+        StorageInsertPair(this, Pair(key, val));
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2227,6 +2535,82 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_end(args_copy);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImArena
+//-----------------------------------------------------------------------------
+
+void* ImArena::Alloc(size_t size)
+{
+    size = (size + 15) & ~(size_t)15;
+    UsedBytes += (int)size;
+    AllocsCount++;
+    if ((size_t)BlockUsed + size <= (size_t)BlockSize)
+    {
+        void* ptr = Block + BlockUsed;
+        BlockUsed += (int)size;
+        return ptr;
+    }
+    void* ptr = IM_ALLOC(size);
+    OverflowAllocs.push_back(ptr);
+    return ptr;
+}
+
+void ImArena::Reset()
+{
+    LastUsedBytes = UsedBytes;
+    LastAllocsCount = AllocsCount;
+    LastOverflowCount = OverflowAllocs.Size;
+    PeakUsedBytes = ImMax(PeakUsedBytes, UsedBytes);
+    for (int n = 0; n < OverflowAllocs.Size; n++)
+        IM_FREE(OverflowAllocs[n]);
+    OverflowAllocs.resize(0);
+
+    // Grow the block to fit everything that was allocated, with some headroom (this is where the block size settles)
+    if (UsedBytes > BlockSize)
+    {
+        if (Block)
+            IM_FREE(Block);
+        BlockSize = ImMax(UsedBytes + UsedBytes / 2, 4096);
+        Block = (char*)IM_ALLOC((size_t)BlockSize);
+    }
+    BlockUsed = UsedBytes = AllocsCount = 0;
+}
+
+void ImArena::Clear()
+{
+    for (int n = 0; n < OverflowAllocs.Size; n++)
+        IM_FREE(OverflowAllocs[n]);
+    OverflowAllocs.clear();
+    if (Block)
+        IM_FREE(Block);
+    Block = NULL;
+    BlockSize = BlockUsed = UsedBytes = AllocsCount = 0;
+}
+
+// Most formatted text fits in g.TempBuffer. Longer text is formatted into g.FrameArena instead of being truncated.
+void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end, const char* fmt, va_list args)
+{
+    ImGuiContext& g = *GImGui;
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int len = ImFormatStringV(g.TempBuffer, IM_ARRAYSIZE(g.TempBuffer), fmt, args_copy);
+    va_end(args_copy);
+    *out_buf = g.TempBuffer;
+    if (len >= IM_ARRAYSIZE(g.TempBuffer) - 1)
+    {
+        va_copy(args_copy, args);
+        const int full_len = ImFormatStringV(NULL, 0, fmt, args_copy);
+        va_end(args_copy);
+        if (full_len > len)
+        {
+            char* buf = (char*)g.FrameArena.Alloc((size_t)full_len + 1);
+            len = ImFormatStringV(buf, (size_t)full_len + 1, fmt, args);
+            *out_buf = buf;
+        }
+    }
+    *out_buf_end = *out_buf + len;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 // This is currently not as flexible/powerful as it should be, needs some rework (see TODO)
@@ -2584,12 +2968,17 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     SetWindowPosVal = SetWindowPosPivot = ImVec2(FLT_MAX, FLT_MAX);
 
     LastFrameActive = -1;
+    LastTimeActive = -1.0f;
     ItemWidthDefault = 0.0f;
     FontWindowScale = 1.0f;
     SettingsIdx = -1;
 
     DrawList = &DrawListInst;
     DrawList->_OwnerName = Name;
+    OccludersInFrontIdx = 0;
+    MemoryCompacted = false;
+    MemoryDrawListIdxCapacity = MemoryDrawListVtxCapacity = 0;
+    memset(MemoryTagsBytes, 0, sizeof(MemoryTagsBytes));
     ParentWindow = NULL;
     RootWindow = NULL;
     RootWindowForTitleBarHighlight = NULL;
@@ -2646,6 +3035,102 @@ ImGuiID ImGuiWindow::GetIDFromRectangle(const ImRect& r_abs)
     return id;
 }
 
+// Reallocate the buffer of a vector to fit its contents (or free it if empty)
+template<typename T>
+static void GcShrinkVector(ImVector<T>& v)
+{
+    if (v.Capacity == v.Size)
+        return;
+    ImVector<T> shrunk;
+    if (v.Size > 0)
+    {
+        shrunk.reserve(v.Size);
+        shrunk.resize(v.Size);
+        memcpy(shrunk.Data, v.Data, (size_t)v.size_in_bytes());
+    }
+    v.swap(shrunk);
+}
+
+template<typename T>
+static int GcVectorMemoryUsage(const ImVector<T>& v)
+{
+    return v.Capacity * (int)sizeof(T);
+}
+
+// Free the transient buffers of a window when it becomes unused (see io.ConfigWindowsMemoryCompactTimer). Called by NewFrame().
+// - Freed: draw list buffers, retained draw list output, temporary stacks.
+// - Shrunk to fit, as they hold persistent data: ID stack, StateStorage (e.g. tree nodes open state), ColumnsStorage.
+// - Not freed: ImGuiWindow, Name, settings.
+// This has no visible effect. When the window is used again, GcAwakeTransientWindowBuffers() reserves the previous draw list capacities at once.
+void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(!window->Active && !window->MemoryCompacted);
+    window->MemoryCompacted = true;
+    window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
+    window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
+    window->DrawList->ClearFreeMemory();
+    window->DrawListsAttached.clear();
+
+    // The retained primitives live in the draw list buffers we just freed: forget them (new buffers may be allocated at the same addresses)
+    ImDrawListRetainedData* retained = &window->RetainedDrawList;
+    retained->PrevPrims.clear();
+    retained->Prims.clear();
+    retained->VtxData = NULL;
+    retained->IdxData = NULL;
+    retained->VtxCapacity = retained->IdxCapacity = 0;
+
+    window->OccluderRect = ImRect();
+    window->OccludersInFrontIdx = 0;
+    window->DC.ChildWindows.clear();
+    window->DC.ItemFlagsStack.clear();
+    window->DC.ItemWidthStack.clear();
+    window->DC.TextWrapPosStack.clear();
+    window->DC.GroupStack.clear();
+    window->IDStack.resize(1);
+    GcShrinkVector(window->IDStack);
+    GcShrinkVector(window->StateStorage.Data);
+    GcShrinkVector(window->StateStorage.HashIndex);
+    for (int n = 0; n < window->ColumnsStorage.Size; n++)
+        GcShrinkVector(window->ColumnsStorage[n].Columns);
+    GcShrinkVector(window->ColumnsStorage);
+    g.WindowsMemoryCompactedCount++;
+}
+
+void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(window->MemoryCompacted);
+    window->MemoryCompacted = false;
+    window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
+    window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
+    window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
+    g.WindowsMemoryCompactedCount--;
+}
+
+// Bytes allocated for a window: structure, name and buffers
+int ImGui::GcCalcWindowMemoryUsage(ImGuiWindow* window)
+{
+    const ImDrawList* draw_list = window->DrawList;
+    int bytes = (int)sizeof(ImGuiWindow) + window->NameBufLen;
+    bytes += GcVectorMemoryUsage(draw_list->CmdBuffer) + GcVectorMemoryUsage(draw_list->IdxBuffer) + GcVectorMemoryUsage(draw_list->VtxBuffer);
+    bytes += GcVectorMemoryUsage(draw_list->_ClipRectStack) + GcVectorMemoryUsage(draw_list->_TextureIdStack) + GcVectorMemoryUsage(draw_list->_Path);
+    bytes += GcVectorMemoryUsage(draw_list->_DeferredPrims) + GcVectorMemoryUsage(draw_list->_DeferredPoints);
+    bytes += GcVectorMemoryUsage(draw_list->_Splitter._Channels);
+    for (int n = 0; n < draw_list->_Splitter._Channels.Size; n++)
+        if (n != draw_list->_Splitter._Current) // Current channel is a copy of CmdBuffer/IdxBuffer
+            bytes += GcVectorMemoryUsage(draw_list->_Splitter._Channels[n].CmdBuffer) + GcVectorMemoryUsage(draw_list->_Splitter._Channels[n].IdxBuffer);
+    bytes += GcVectorMemoryUsage(window->RetainedDrawList.PrevPrims) + GcVectorMemoryUsage(window->RetainedDrawList.Prims);
+    bytes += GcVectorMemoryUsage(window->DrawListsAttached);
+    bytes += GcVectorMemoryUsage(window->DC.ChildWindows) + GcVectorMemoryUsage(window->DC.ItemFlagsStack) + GcVectorMemoryUsage(window->DC.ItemWidthStack);
+    bytes += GcVectorMemoryUsage(window->DC.TextWrapPosStack) + GcVectorMemoryUsage(window->DC.GroupStack);
+    bytes += GcVectorMemoryUsage(window->IDStack) + GcVectorMemoryUsage(window->StateStorage.Data) + GcVectorMemoryUsage(window->StateStorage.HashIndex);
+    bytes += GcVectorMemoryUsage(window->ColumnsStorage);
+    for (int n = 0; n < window->ColumnsStorage.Size; n++)
+        bytes += GcVectorMemoryUsage(window->ColumnsStorage[n].Columns);
+    return bytes;
+}
+
 static void SetCurrentWindow(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -3007,9 +3492,17 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
-    if (ImGuiContext* ctx = GImGui)
+    ImGuiContext* ctx = GImGui;
+    if (ctx)
+    {
         ctx->IO.MetricsActiveAllocations++;
-    return GImAllocatorAllocFunc(size, GImAllocatorUserData);
+        if (ctx->AllocAuditStartFrame != -1)
+            AllocAuditRecordAlloc(ctx, size);
+    }
+    void* ptr = GImAllocatorAllocFunc(size, GImAllocatorUserData);
+    if (ctx && ctx->MemoryTagsEnabled)
+        MemoryTrackAlloc(ctx, ptr, size);
+    return ptr;
 }
 
 // IM_FREE() == ImGui::MemFree()
@@ -3017,10 +3510,25 @@ void ImGui::MemFree(void* ptr)
 {
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
+        {
             ctx->IO.MetricsActiveAllocations--;
+            if (ctx->MemoryAllocsCount > 0)
+                MemoryTrackFree(ctx, ptr);
+        }
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
+// Doesn't touch the current context, so it may be called from any thread as long as the allocator functions are thread-safe.
+void* ImGui::MemAllocUntracked(size_t size)
+{
+    return GImAllocatorAllocFunc(size, GImAllocatorUserData);
+}
+
+void ImGui::MemFreeUntracked(void* ptr)
+{
+    GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
+}
+
 const char* ImGui::GetClipboardText()
 {
     return GImGui->IO.GetClipboardTextFn ? GImGui->IO.GetClipboardTextFn(GImGui->IO.ClipboardUserData) : "";
@@ -3147,6 +3655,38 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+ImDrawListSharedData* ImGui::CreateDrawListSharedData()
+{
+    // Deferred tessellation is disabled: threads building their own draw lists can tessellate them, and ImDrawList::AddDrawList() requires tessellated sources.
+    // Glyphs are not rasterized on demand: it would modify the font atlas from other threads, and evictions by the main thread would change the glyphs they use.
+    ImGuiContext& g = *GImGui;
+    ImDrawListSharedData* shared_data = IM_NEW(ImDrawListSharedData)(g.DrawListSharedData);
+    shared_data->InitialFlags &= ~ImDrawListFlags_DeferTessellation;
+    shared_data->InitialFlags |= ImDrawListFlags_NoRasterizeGlyphs;
+    return shared_data;
+}
+
+void ImGui::DestroyDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    IM_DELETE(shared_data);
+}
+
+void ImGui::AddDrawListToWindow(ImDrawList* draw_list)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    IM_ASSERT(draw_list != window->DrawList);
+    if (window->SkipItems)
+        return;
+    window->DrawListsAttached.push_back(ImGuiDrawListAttachment(draw_list, window->DrawList->_ClipRectStack.back(), window->DrawList->_TextureIdStack.back()));
+}
+
+void ImGui::AddDrawListToForeground(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(draw_list != &g.ForegroundDrawList);
+    g.ForegroundDrawListsAttached.push_back(ImGuiDrawListAttachment(draw_list, g.ForegroundDrawList._ClipRectStack.back(), g.ForegroundDrawList._TextureIdStack.back()));
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -3442,6 +3982,7 @@ void ImGui::NewFrame()
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     ImGuiTestEngineHook_PreNewFrame(&g);
 #endif
+    g.AllocAuditTag = "NewFrame";
 
     // Check user data
     // (We pass an error message in the assert expression to make it visible to programmers who are not using a debugger, as most assert handlers display their argument)
@@ -3493,11 +4034,18 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.FrameScopeActive = true;
     g.FrameCount += 1;
+    AllocAuditNewFrame();
+    g.FrameArena.Reset();
+    MemoryNewFrame();
+    ProfilerNewFrame();
+    if (g.ProfilerActive)
+        ProfilerBeginScope("NewFrame");
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
 
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
+    g.IO.Fonts->DynamicFrameCount++;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
@@ -3509,12 +4057,15 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.ConfigDeferTessellation)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_DeferTessellation;
 
     g.BackgroundDrawList.Clear();
     g.BackgroundDrawList.PushTextureID(g.IO.Fonts->TexID);
     g.BackgroundDrawList.PushClipRectFullScreen();
 
     g.ForegroundDrawList.Clear();
+    g.ForegroundDrawListsAttached.resize(0);
     g.ForegroundDrawList.PushTextureID(g.IO.Fonts->TexID);
     g.ForegroundDrawList.PushClipRectFullScreen();
 
@@ -3568,6 +4119,7 @@ void ImGui::NewFrame()
 
     // Update mouse input state
     UpdateMouseInputs();
+    UpdateInputEventsThisFrame();
 
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
@@ -3623,8 +4175,10 @@ void ImGui::NewFrame()
 
     g.NavIdTabCounter = INT_MAX;
 
-    // Mark all windows as not visible
+    // Mark all windows as not visible and compact unused memory
     IM_ASSERT(g.WindowsFocusOrder.Size == g.Windows.Size);
+    const float memory_compact_start_time = (g.IO.ConfigWindowsMemoryCompactTimer >= 0.0f) ? (float)g.Time - g.IO.ConfigWindowsMemoryCompactTimer : -FLT_MAX;
+    g.WindowsMemoryUsage = 0;
     for (int i = 0; i != g.Windows.Size; i++)
     {
         ImGuiWindow* window = g.Windows[i];
@@ -3632,7 +4186,13 @@ void ImGui::NewFrame()
         window->BeginCount = 0;
         window->Active = false;
         window->WriteAccessed = false;
+
+        // Garbage collect transient buffers of windows unused for a while
+        if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
+            GcCompactTransientWindowBuffers(window);
+        g.WindowsMemoryUsage += GcCalcWindowMemoryUsage(window);
     }
+    g.WindowsMemoryUsagePeak = ImMax(g.WindowsMemoryUsagePeak, g.WindowsMemoryUsage);
 
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
@@ -3650,6 +4210,9 @@ void ImGui::NewFrame()
     SetNextWindowSize(ImVec2(400,400), ImGuiCond_FirstUseEver);
     Begin("Debug##Default");
     g.FrameScopePushedImplicitWindow = true;
+    g.AllocAuditTag = NULL;
+    if (g.ProfilerActive)
+        ProfilerEndScope();
 
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     ImGuiTestEngineHook_PostNewFrame(&g);
@@ -3668,6 +4231,8 @@ void ImGui::Initialize(ImGuiContext* context)
     ini_handler.ReadOpenFn = SettingsHandlerWindow_ReadOpen;
     ini_handler.ReadLineFn = SettingsHandlerWindow_ReadLine;
     ini_handler.WriteAllFn = SettingsHandlerWindow_WriteAll;
+    ini_handler.ReadBinaryFn = SettingsHandlerWindow_ReadBinary;
+    ini_handler.WriteBinaryFn = SettingsHandlerWindow_WriteBinary;
     g.SettingsHandlers.push_back(ini_handler);
 
     g.Initialized = true;
@@ -3685,6 +4250,10 @@ void ImGui::Shutdown(ImGuiContext* context)
     }
     g.IO.Fonts = NULL;
 
+    // Stop tracking allocations (see g.MemoryTagsEnabled)
+    g.MemoryTagsEnabled = false;
+    MemoryClearAllocs(&g);
+
     // Cleanup of other data are conditional on actually having initialized ImGui.
     if (!g.Initialized)
         return;
@@ -3719,14 +4288,26 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.DrawDataBuilder.ClearFreeMemory();
     g.BackgroundDrawList.ClearFreeMemory();
     g.ForegroundDrawList.ClearFreeMemory();
+    g.ForegroundDrawListsAttached.clear();
+    g.FlattenedDrawList.ClearFreeMemory();
+    g.FlattenLists.clear();
     g.PrivateClipboard.clear();
     g.InputTextState.ClearFreeMemory();
+    g.FrameArena.Clear();
 
     for (int i = 0; i < g.SettingsWindows.Size; i++)
         IM_DELETE(g.SettingsWindows[i].Name);
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
+    g.SettingsWindowsIniCache.clear();
+    g.SettingsBinaryData.clear();
     g.SettingsHandlers.clear();
 
+    for (int i = 0; i < g.ProfilerFrames.Size; i++)
+        g.ProfilerFrames[i].Scopes.clear();
+    g.ProfilerFrames.clear();
+    g.ProfilerScopeStack.clear();
+
     if (g.LogFile && g.LogFile != stdout)
     {
         fclose(g.LogFile);
@@ -3766,8 +4347,91 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
     }
 }
 
+// Retained draw lists (ImGuiWindowFlags_RetainDrawList, see ImDrawListRetainedData)
+// Lines, filled shapes and text submitted with the same parameters at the same position as during the previous frame reuse their output in place.
+// A change only affects the primitives from the first one whose parameters or position changed, until positions line up with the previous frame again.
+static void BeginWindowRetainedDrawList(ImGuiWindow* window)
+{
+    ImDrawListRetainedData* retained = &window->RetainedDrawList;
+    ImDrawList* draw_list = window->DrawList;
+
+    // The buffers still hold the output of the previous frame, unless they were reallocated after EndWindowRetainedDrawList() (e.g. ImDrawData::DeIndexAllBuffers())
+    retained->PrevPrims.swap(retained->Prims);
+    retained->Prims.resize(0);
+    if (draw_list->VtxBuffer.Data != retained->VtxData || draw_list->VtxBuffer.Capacity != retained->VtxCapacity || draw_list->IdxBuffer.Data != retained->IdxData || draw_list->IdxBuffer.Capacity != retained->IdxCapacity)
+        retained->PrevPrims.resize(0);
+    retained->PrevPrimsIdx = 0;
+    retained->ReusedCount = retained->TessellatedCount = 0;
+    draw_list->Flags |= ImDrawListFlags_RetainTessellation;
+    draw_list->_Retained = retained;
+}
+
+// Called when adding the window to the draw data, once its draw list is complete
+static void EndWindowRetainedDrawList(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawListRetainedData* retained = &window->RetainedDrawList;
+    ImDrawList* draw_list = window->DrawList;
+    retained->VtxData = draw_list->VtxBuffer.Data;
+    retained->IdxData = draw_list->IdxBuffer.Data;
+    retained->VtxCapacity = draw_list->VtxBuffer.Capacity;
+    retained->IdxCapacity = draw_list->IdxBuffer.Capacity;
+    retained->ReusedCountTotal += retained->ReusedCount;
+    retained->TessellatedCountTotal += retained->TessellatedCount;
+    g.RetainedDrawListsReusedCount += retained->ReusedCount;
+    g.RetainedDrawListsTessellatedCount += retained->TessellatedCount;
+}
+
+// Conservative occlusion test against the opaque rectangles of the windows in front of the draw list (see io.ConfigOcclusionCulling)
+// Each command may be hidden by a different occluder. 'out_bb' receives the hidden area, for Metrics.
+static bool IsDrawListOccluded(const ImDrawList* draw_list, ImRect* out_bb)
+{
+    ImGuiContext& g = *GImGui;
+    const ImRect* occluders_begin = g.Occluders.Data + g.OccludersInFrontIdx;
+    const ImRect* occluders_end = g.Occluders.Data + g.Occluders.Size;
+    const ImRect display_rect(ImVec2(0.0f, 0.0f), g.IO.DisplaySize);
+    ImRect bb;
+    for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        // Callbacks may render anything, anywhere
+        const ImDrawCmd* cmd = &draw_list->CmdBuffer.Data[cmd_n];
+        if (cmd->UserCallback != NULL)
+            return false;
+        if (cmd->ElemCount == 0)
+            continue;
+
+        // Everything a command renders is inside its clipping rectangle, rounded outward as back-ends may round the scissor rectangle either way
+        ImRect clip_rect(ImFloorStd(cmd->ClipRect.x), ImFloorStd(cmd->ClipRect.y), ImCeil(cmd->ClipRect.z), ImCeil(cmd->ClipRect.w));
+        clip_rect.ClipWithFull(display_rect);
+        const ImRect* occluder = occluders_begin;
+        while (occluder != occluders_end && !occluder->Contains(clip_rect))
+            occluder++;
+
+        // Window decorations use the whole viewport as clipping rectangle: tighten with the bounding box of their vertices.
+        // Vertices of primitives recorded with ImDrawListFlags_DeferTessellation are not written yet.
+        if (occluder == occluders_end)
+        {
+            if (draw_list->_DeferredPrims.Size > 0)
+                return false;
+            clip_rect.ClipWithFull(ImDrawIdxRangeCalcVtxBounds(draw_list, cmd->VtxOffset, cmd->IdxOffset, cmd->ElemCount));
+            for (occluder = occluders_begin; occluder != occluders_end; occluder++)
+                if (occluder->Contains(clip_rect))
+                    break;
+            if (occluder == occluders_end)
+                return false;
+        }
+        clip_rect.ClipWithFull(*occluder);
+        bb.Add(clip_rect);
+    }
+    if (bb.Min.x > bb.Max.x)
+        return false;
+    *out_bb = bb;
+    return true;
+}
+
 static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list)
 {
+    ImGuiContext& g = *GImGui;
     if (draw_list->CmdBuffer.empty())
         return;
 
@@ -3805,14 +4469,44 @@ static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* d
     if (sizeof(ImDrawIdx) == 2)
         IM_ASSERT(draw_list->_VtxCurrentIdx < (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
 
+    // Skip draw lists hidden behind opaque windows
+    ImRect occluded_bb;
+    if (g.OccludersInFrontIdx < g.Occluders.Size && IsDrawListOccluded(draw_list, &occluded_bb))
+    {
+        g.OcclusionCulledRects.push_back(occluded_bb);
+        g.OcclusionCulledVtxCount += draw_list->VtxBuffer.Size;
+        return;
+    }
+
     out_list->push_back(draw_list);
 }
 
+// Clip the commands of a draw list built outside of the frame to the clip rectangle current when it was attached, and give the texture id current
+// at that point to those without texture. This modifies the commands in place: a draw list can only be attached once per frame, and its commands
+// need to be rebuilt before it is attached again (otherwise they would stay clipped to the previous attachment).
+static void AddAttachedDrawListToDrawData(ImVector<ImDrawList*>* out_list, const ImGuiDrawListAttachment& attachment)
+{
+    ImDrawList* draw_list = attachment.DrawList;
+    const ImVec4& clip_rect = attachment.ClipRect;
+    for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+        cmd.ClipRect = ImVec4(ImMax(cmd.ClipRect.x, clip_rect.x), ImMax(cmd.ClipRect.y, clip_rect.y), ImMin(cmd.ClipRect.z, clip_rect.z), ImMin(cmd.ClipRect.w, clip_rect.w));
+        if (cmd.TextureId == (ImTextureID)NULL)
+            cmd.TextureId = attachment.TextureId;
+    }
+    AddDrawListToDrawData(out_list, draw_list);
+}
+
 static void AddWindowToDrawData(ImVector<ImDrawList*>* out_render_list, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
     g.IO.MetricsRenderWindows++;
+    if (window->DrawList->Flags & ImDrawListFlags_RetainTessellation)
+        EndWindowRetainedDrawList(window);
     AddDrawListToDrawData(out_render_list, window->DrawList);
+    for (int i = 0; i < window->DrawListsAttached.Size; i++)
+        AddAttachedDrawListToDrawData(out_render_list, window->DrawListsAttached[i]);
     for (int i = 0; i < window->DC.ChildWindows.Size; i++)
     {
         ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -3825,12 +4519,67 @@ static void AddWindowToDrawData(ImVector<ImDrawList*>* out_render_list, ImGuiWin
 static void AddRootWindowToDrawData(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
+    g.OccludersInFrontIdx = window->OccludersInFrontIdx;
     if (window->Flags & ImGuiWindowFlags_Tooltip)
         AddWindowToDrawData(&g.DrawDataBuilder.Layers[1], window);
     else
         AddWindowToDrawData(&g.DrawDataBuilder.Layers[0], window);
 }
 
+// Add the pixels covered by an opaque rectangle, expanded to the largest rectangle whose interior only contains the centers of those pixels.
+// (pixels are covered when their center is inside the rectangle or on its top/left edges, draw lists are tested against their bounding box)
+static void AddOccluder(const ImRect& r)
+{
+    ImGuiContext& g = *GImGui;
+    if (r.Min.x < r.Max.x && r.Min.y < r.Max.y)
+        g.Occluders.push_back(ImRect(ImCeil(r.Min.x - 0.5f) - 0.5f, ImCeil(r.Min.y - 0.5f) - 0.5f, ImCeil(r.Max.x - 0.5f) + 0.5f, ImCeil(r.Max.y - 0.5f) + 0.5f));
+}
+
+// Only the background and title bar of root windows are used as occluders: child windows are mostly inside their parent anyway.
+// Rounded windows are shrunk to exclude corners and anti-aliased edges.
+static void AddRootWindowToOccluders(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImRect r = window->OccluderRect;
+    for (int cmd_n = 0; cmd_n < window->DrawList->CmdBuffer.Size; cmd_n++)
+        if (window->DrawList->CmdBuffer[cmd_n].UserCallback != NULL) // A callback could change how the background is rendered
+            r = ImRect();
+    const float rounding = window->WindowRounding;
+    if (rounding > 0.0f)
+    {
+        r.Expand(-1.0f);
+        AddOccluder(ImRect(r.Min.x + rounding, r.Min.y, r.Max.x - rounding, r.Max.y));
+        AddOccluder(ImRect(r.Min.x, r.Min.y + rounding, r.Max.x, r.Max.y - rounding));
+    }
+    else
+    {
+        AddOccluder(r);
+    }
+    window->OccludersInFrontIdx = g.Occluders.Size;
+}
+
+// Gather occluders in the order AddRootWindowToDrawData() is called by Render(): layer 0 then layer 1 (tooltips)
+static void BuildOccluders(ImGuiWindow* const windows_to_render_front_most[2])
+{
+    ImGuiContext& g = *GImGui;
+    for (int layer_n = 0; layer_n < 2; layer_n++)
+    {
+        for (int n = 0; n != g.Windows.Size; n++)
+        {
+            ImGuiWindow* window = g.Windows[n];
+            if (IsWindowActiveAndVisible(window) && (window->Flags & ImGuiWindowFlags_ChildWindow) == 0 && window != windows_to_render_front_most[0] && window != windows_to_render_front_most[1])
+                if (((window->Flags & ImGuiWindowFlags_Tooltip) != 0) == (layer_n == 1))
+                    AddRootWindowToOccluders(window);
+        }
+        for (int n = 0; n < 2; n++)
+        {
+            ImGuiWindow* window = windows_to_render_front_most[n];
+            if (window && IsWindowActiveAndVisible(window) && ((window->Flags & ImGuiWindowFlags_Tooltip) != 0) == (layer_n == 1))
+                AddRootWindowToOccluders(window);
+        }
+    }
+}
+
 void ImDrawDataBuilder::FlattenIntoSingleLayer()
 {
     int n = Layers[0].Size;
@@ -3866,6 +4615,78 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
     }
 }
 
+static void TessellateJobFunc(void* data, int n)
+{
+    const ImDrawTessellateJob& job = ((const ImDrawTessellateJob*)data)[n];
+    job.DrawList->TessellateDeferredRange(job.PrimBegin, job.PrimEnd);
+}
+
+// Write vertices of lines and filled shapes recorded with ImDrawListFlags_DeferTessellation (see io.ConfigDeferTessellation).
+// Primitives of each draw list are split into jobs of a few thousands points, which are run in parallel with io.ParallelForFn if provided.
+static void TessellateDeferredDrawLists(ImDrawData* draw_data)
+{
+    ImGuiContext& g = *GImGui;
+    g.TessellateJobs.resize(0);
+    g.TessellatePrimsCount = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        ImDrawList* draw_list = draw_data->CmdLists[n];
+        for (int prim_begin = 0, points_count = 0, prim_n = 0; prim_n < draw_list->_DeferredPrims.Size; prim_n++)
+        {
+            points_count += draw_list->_DeferredPrims[prim_n].PointsCount;
+            if (points_count < TESSELLATE_JOB_POINTS_MIN && prim_n + 1 < draw_list->_DeferredPrims.Size)
+                continue;
+            ImDrawTessellateJob job = { draw_list, prim_begin, prim_n + 1 };
+            g.TessellateJobs.push_back(job);
+            prim_begin = prim_n + 1;
+            points_count = 0;
+        }
+        g.TessellatePrimsCount += draw_list->_DeferredPrims.Size;
+    }
+    if (g.TessellateJobs.Size == 0)
+        return;
+
+    if (g.IO.ParallelForFn != NULL && g.TessellateJobs.Size > 1)
+        g.IO.ParallelForFn(g.IO.ParallelForUserData, TessellateJobFunc, g.TessellateJobs.Data, g.TessellateJobs.Size);
+    else
+        for (int n = 0; n < g.TessellateJobs.Size; n++)
+            TessellateJobFunc(g.TessellateJobs.Data, n);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        draw_data->CmdLists[n]->_DeferredPrims.resize(0);
+        draw_data->CmdLists[n]->_DeferredPoints.resize(0);
+    }
+}
+
+static void FlattenJobFunc(void* data, int n)
+{
+    ImGuiContext& g = *(ImGuiContext*)data;
+    ImDrawDataFlattenCopy(&g.FlattenedDrawList, g.FlattenLists[n]);
+}
+
+// Replace the draw lists of 'draw_data' with their concatenation in g.FlattenedDrawList (see io.ConfigFlattenDrawData).
+// Draw lists are copied in parallel with io.ParallelForFn if provided.
+static void FlattenDrawData(ImDrawData* draw_data)
+{
+    ImGuiContext& g = *GImGui;
+    g.FlattenedListsCount = g.FlattenedSegmentsCount = 0;
+    if (draw_data->CmdListsCount <= 1)
+        return;
+    const int segments_count = ImDrawDataFlattenLayout(draw_data, &g.FlattenedDrawList, true, &g.FlattenLists);
+    if (sizeof(ImDrawIdx) == 2 && segments_count > 1 && !(g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset))
+        return;
+
+    if (g.IO.ParallelForFn != NULL)
+        g.IO.ParallelForFn(g.IO.ParallelForUserData, FlattenJobFunc, &g, g.FlattenLists.Size);
+    else
+        for (int n = 0; n < g.FlattenLists.Size; n++)
+            FlattenJobFunc(&g, n);
+    g.FlattenedListsCount = draw_data->CmdListsCount;
+    g.FlattenedSegmentsCount = segments_count;
+    draw_data->CmdLists = g.FlattenedCmdLists;
+    draw_data->CmdListsCount = 1;
+}
+
 // When using this function it is sane to ensure that float are perfectly rounded to integer values, to that e.g. (int)(max.x-min.x) in user's render produce correct result.
 void ImGui::PushClipRect(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max, bool intersect_with_current_clip_rect)
 {
@@ -3881,6 +4702,56 @@ void ImGui::PopClipRect()
     window->ClipRect = window->DrawList->_ClipRectStack.back();
 }
 
+void ImGui::RequestNextFrame(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    delay = ImMax(delay, 0.0f);
+    g.NextFrameTimeoutRequest = ImMin(g.NextFrameTimeoutRequest, delay);
+    g.IO.NextFrameTimeout = ImMin(g.IO.NextFrameTimeout, delay);
+}
+
+// Mouse moves are not included, they are only relevant to the hovered window
+static void ImGui::UpdateInputEventsThisFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    bool has_input = (io.MouseWheel != 0.0f || io.MouseWheelH != 0.0f || !io.InputQueueCharacters.empty());
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown) && !has_input; n++)
+        has_input = io.MouseDown[n] || io.MouseReleased[n];
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown) && !has_input; n++)
+        has_input = io.KeysDown[n] || io.KeysDownDurationPrev[n] >= 0.0f;
+    for (int n = 0; n < IM_ARRAYSIZE(io.NavInputs) && !has_input; n++)
+        has_input = io.NavInputs[n] > 0.0f || io.NavInputsDownDurationPrev[n] >= 0.0f;
+    has_input |= io.KeyCtrl || io.KeyShift || io.KeyAlt || io.KeySuper;
+    g.InputEventsThisFrame = has_input;
+}
+
+// Called by EndFrame(), before clearing the input data of the frame
+static void ImGui::UpdateNextFrameTimeout()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+
+    // Input events
+    bool has_input = g.InputEventsThisFrame || (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f);
+    has_input |= (io.DisplaySize.x != g.NextFrameLastDisplaySize.x || io.DisplaySize.y != g.NextFrameLastDisplaySize.y);
+    g.FramesSinceLastInput = has_input ? 0 : g.FramesSinceLastInput + 1;
+    g.NextFrameLastDisplaySize = io.DisplaySize;
+
+    // Requests made during the frame (e.g. by Begin() for windows still appearing or auto-fitting, by InputText() for the blinking cursor)
+    float timeout = g.NextFrameTimeoutRequest;
+    g.NextFrameTimeoutRequest = FLT_MAX;
+    if (g.FramesSinceLastInput < IDLE_FRAMES_AFTER_INPUT)
+        timeout = 0.0f;
+    if (g.HoveredId != 0 && g.HoveredIdTimer < IDLE_HOVER_TIMERS_DURATION)
+        timeout = 0.0f;
+    if (g.NavWindowingTarget != NULL || g.DragDropActive || g.MovingWindow != NULL)
+        timeout = 0.0f;
+    if (g.SettingsDirtyTimer > 0.0f)
+        timeout = ImMin(timeout, g.SettingsDirtyTimer);
+    io.NextFrameTimeout = timeout;
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
@@ -3889,6 +4760,9 @@ void ImGui::EndFrame()
     if (g.FrameCountEnded == g.FrameCount)          // Don't process EndFrame() multiple times.
         return;
     IM_ASSERT(g.FrameScopeActive && "Forgot to call ImGui::NewFrame()?");
+    g.AllocAuditTag = "EndFrame";
+    if (g.ProfilerActive)
+        ProfilerBeginScope("EndFrame");
 
     // Notify OS when our Input Method Editor cursor has moved (e.g. CJK inputs using Microsoft IME)
     if (g.IO.ImeSetInputScreenPosFn && (g.PlatformImeLastPos.x == FLT_MAX || ImLengthSqr(g.PlatformImeLastPos - g.PlatformImePos) > 0.0001f))
@@ -3967,32 +4841,48 @@ void ImGui::EndFrame()
     // Unlock font atlas
     g.IO.Fonts->Locked = false;
 
+    UpdateNextFrameTimeout();
+
     // Clear Input data for next frame
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
     memset(g.IO.NavInputs, 0, sizeof(g.IO.NavInputs));
+    g.AllocAuditTag = NULL;
+    if (g.ProfilerActive)
+        ProfilerEndScope();
 }
 
 void ImGui::Render()
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
+    if (g.ProfilerActive)
+        ProfilerBeginScope("Render");
 
     if (g.FrameCountEnded != g.FrameCount)
         EndFrame();
+    g.AllocAuditTag = "Render";
     g.FrameCountRendered = g.FrameCount;
 
     // Gather ImDrawList to render (for each active window)
+    if (g.ProfilerActive)
+        ProfilerBeginScope("AddDrawListsToDrawData");
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = g.IO.MetricsRenderWindows = 0;
     g.DrawDataBuilder.Clear();
-    if (!g.BackgroundDrawList.VtxBuffer.empty())
-        AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.BackgroundDrawList);
-
     ImGuiWindow* windows_to_render_front_most[2];
     windows_to_render_front_most[0] = (g.NavWindowingTarget && !(g.NavWindowingTarget->Flags & ImGuiWindowFlags_NoBringToFrontOnFocus)) ? g.NavWindowingTarget->RootWindow : NULL;
     windows_to_render_front_most[1] = g.NavWindowingTarget ? g.NavWindowingList : NULL;
-    for (int n = 0; n != g.Windows.Size; n++)
-    {
+    g.Occluders.resize(0);
+    g.OccludersInFrontIdx = 0;
+    g.OcclusionCulledRects.resize(0);
+    g.OcclusionCulledVtxCount = 0;
+    if (g.IO.ConfigOcclusionCulling)
+        BuildOccluders(windows_to_render_front_most);
+
+    if (!g.BackgroundDrawList.VtxBuffer.empty())
+        AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.BackgroundDrawList);
+    for (int n = 0; n != g.Windows.Size; n++)
+    {
         ImGuiWindow* window = g.Windows[n];
         if (IsWindowActiveAndVisible(window) && (window->Flags & ImGuiWindowFlags_ChildWindow) == 0 && window != windows_to_render_front_most[0] && window != windows_to_render_front_most[1])
             AddRootWindowToDrawData(window);
@@ -4001,6 +4891,9 @@ void ImGui::Render()
         if (windows_to_render_front_most[n] && IsWindowActiveAndVisible(windows_to_render_front_most[n])) // NavWindowingTarget is always temporarily displayed as the front-most window
             AddRootWindowToDrawData(windows_to_render_front_most[n]);
     g.DrawDataBuilder.FlattenIntoSingleLayer();
+    g.OccludersInFrontIdx = g.Occluders.Size;
+    if (g.ProfilerActive)
+        ProfilerEndScope();
 
     // Draw software mouse cursor if requested
     if (g.IO.MouseDrawCursor)
@@ -4008,11 +4901,43 @@ void ImGui::Render()
 
     if (!g.ForegroundDrawList.VtxBuffer.empty())
         AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.ForegroundDrawList);
+    for (int n = 0; n < g.ForegroundDrawListsAttached.Size; n++)
+        AddAttachedDrawListToDrawData(&g.DrawDataBuilder.Layers[0], g.ForegroundDrawListsAttached[n]);
 
     // Setup ImDrawData structure for end-user
     SetupDrawData(&g.DrawDataBuilder.Layers[0], &g.DrawData);
     g.IO.MetricsRenderVertices = g.DrawData.TotalVtxCount;
+    if (g.ProfilerActive)
+        ProfilerBeginScope("TessellateDeferred");
+    TessellateDeferredDrawLists(&g.DrawData);
+    if (g.ProfilerActive)
+        ProfilerEndScope();
+    if (g.IO.ConfigFlattenDrawData)
+    {
+        if (g.ProfilerActive)
+            ProfilerBeginScope("FlattenDrawData");
+        FlattenDrawData(&g.DrawData);
+        if (g.ProfilerActive)
+            ProfilerEndScope();
+    }
+    if (g.IO.ConfigMergeDrawCmds)
+    {
+        if (g.ProfilerActive)
+            ProfilerBeginScope("MergeDrawCmds");
+        g.MergeDrawCmdsBeforeCount = 0;
+        for (int n = 0; n < g.DrawData.CmdListsCount; n++)
+            g.MergeDrawCmdsBeforeCount += g.DrawData.CmdLists[n]->CmdBuffer.Size;
+        g.MergeDrawCmdsAfterCount = g.MergeDrawCmdsBeforeCount - g.DrawData.MergeDrawCmds();
+        if (g.ProfilerActive)
+            ProfilerEndScope();
+    }
     g.IO.MetricsRenderIndices = g.DrawData.TotalIdxCount;
+    g.AllocAuditTag = NULL;
+    if (g.ProfilerActive)
+    {
+        ProfilerEndScope();
+        g.ProfilerActive = false;
+    }
 
     // (Legacy) Call the Render callback function. The current prefer way is to let the user retrieve GetDrawData() and call the render function themselves.
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -5008,6 +5933,7 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
     // As we highlight the title bar when want_focus is set, multiple reappearing windows will have have their title bar highlighted on their reappearing frame.
     const float window_rounding = window->WindowRounding;
     const float window_border_size = window->WindowBorderSize;
+    window->OccluderRect = ImRect();
     if (window->Collapsed)
     {
         // Title bar only
@@ -5020,6 +5946,7 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
     else
     {
         // Window background
+        bool bg_is_opaque = false;
         if (!(flags & ImGuiWindowFlags_NoBackground))
         {
             ImU32 bg_col = GetColorU32(GetWindowBgColorIdxFromFlags(flags));
@@ -5029,15 +5956,22 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
             if (alpha != 1.0f)
                 bg_col = (bg_col & ~IM_COL32_A_MASK) | (IM_F32_TO_INT8_SAT(alpha) << IM_COL32_A_SHIFT);
             window->DrawList->AddRectFilled(window->Pos + ImVec2(0, window->TitleBarHeight()), window->Pos + window->Size, bg_col, window_rounding, (flags & ImGuiWindowFlags_NoTitleBar) ? ImDrawCornerFlags_All : ImDrawCornerFlags_Bot);
+            bg_is_opaque = (bg_col & IM_COL32_A_MASK) == IM_COL32_A_MASK;
         }
 
         // Title bar
+        bool title_bar_is_opaque = true;
         if (!(flags & ImGuiWindowFlags_NoTitleBar))
         {
             ImU32 title_bar_col = GetColorU32(title_bar_is_highlight ? ImGuiCol_TitleBgActive : ImGuiCol_TitleBg);
             window->DrawList->AddRectFilled(title_bar_rect.Min, title_bar_rect.Max, title_bar_col, window_rounding, ImDrawCornerFlags_Top);
+            title_bar_is_opaque = (title_bar_col & IM_COL32_A_MASK) == IM_COL32_A_MASK;
         }
 
+        // Record what hides the windows behind us (see io.ConfigOcclusionCulling). Rounded corners are excluded by Render().
+        if (bg_is_opaque)
+            window->OccluderRect = ImRect(window->Pos + ImVec2(0, title_bar_is_opaque ? 0.0f : window->TitleBarHeight()), window->Pos + window->Size);
+
         // Menu bar
         if (flags & ImGuiWindowFlags_MenuBar)
         {
@@ -5196,6 +6130,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         ImVec2 size_on_first_use = (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasSize) ? g.NextWindowData.SizeVal : ImVec2(0.0f, 0.0f); // Any condition flag will do since we are creating a new window here.
         window = CreateNewWindow(name, size_on_first_use, flags);
     }
+    if (g.ProfilerActive && g.CurrentWindowStack.Size > 0) // Implicit "Debug" window is not recorded, its Begin/End calls straddle NewFrame/EndFrame
+        ProfilerBeginScope(window->Name);
 
     // Automatically disable manual moving/resizing when NoInputs is set
     if ((flags & ImGuiWindowFlags_NoInputs) == ImGuiWindowFlags_NoInputs)
@@ -5225,6 +6161,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     {
         window->Flags = (ImGuiWindowFlags)flags;
         window->LastFrameActive = current_frame;
+        window->LastTimeActive = (float)g.Time;
         window->BeginOrderWithinParent = 0;
         window->BeginOrderWithinContext = (short)(g.WindowsActiveCount++);
     }
@@ -5306,6 +6243,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         window->Active = true;
         window->HasCloseButton = (p_open != NULL);
+        if (window->MemoryCompacted)
+            GcAwakeTransientWindowBuffers(window);
         window->ClipRect = ImVec4(-FLT_MAX,-FLT_MAX,+FLT_MAX,+FLT_MAX);
         window->IDStack.resize(1);
 
@@ -5552,6 +6491,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Setup draw list and outer clipping rectangle
         window->DrawList->Clear();
+        window->DrawListsAttached.resize(0);
+        if (flags & ImGuiWindowFlags_RetainDrawList)
+            BeginWindowRetainedDrawList(window);
         window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
         PushClipRect(host_rect.Min, host_rect.Max, false);
 
@@ -5648,6 +6590,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         if (window->AutoFitFramesY > 0)
             window->AutoFitFramesY--;
 
+        // Window still appearing, auto-fitting or scrolling: request another frame (see io.NextFrameTimeout)
+        if (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->ScrollTarget.x < FLT_MAX || window->ScrollTarget.y < FLT_MAX)
+            RequestNextFrame();
+
         // Apply focus (we need to call FocusWindow() AFTER setting DC.CursorStartPos so our initial navigation reference rectangle can start around there)
         if (want_focus)
         {
@@ -5767,6 +6713,8 @@ void ImGui::End()
         g.BeginPopupStack.pop_back();
     CheckStacksSize(window, false);
     SetCurrentWindow(g.CurrentWindowStack.empty() ? NULL : g.CurrentWindowStack.back());
+    if (g.ProfilerActive && g.CurrentWindowStack.Size > 0)
+        ProfilerEndScope();
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -9360,6 +10308,30 @@ void ImGui::LogButtons()
 // [SECTION] SETTINGS
 //-----------------------------------------------------------------------------
 
+// Binary settings layout. Values are stored with native endianness: data from a machine with a different endianness will fail the version check.
+// - Header:   char Magic[4] = "IMGS", ImU32 Version, ImU32 SectionsCount
+// - Sections: ImU32 TypeHash, ImU32 Format (SettingsBinaryFormat_XXX), ImU32 Size, then Size bytes of data
+// Handlers that don't provide ReadBinaryFn/WriteBinaryFn are stored in .ini text format and parsed as text when loading.
+static const char   SETTINGS_BINARY_MAGIC[4] = { 'I', 'M', 'G', 'S' };
+static const ImU32  SETTINGS_BINARY_VERSION = 1;    // Increment when the layout of any binary handler changes
+static const size_t SETTINGS_BINARY_HEADER_SIZE = 12;
+static const size_t SETTINGS_BINARY_SECTION_HEADER_SIZE = 12;
+enum SettingsBinaryFormat_ { SettingsBinaryFormat_Binary = 0, SettingsBinaryFormat_Text = 1 };
+
+static void SettingsBinaryAppend(ImVector<char>* buf, const void* data, size_t data_size)
+{
+    const int off = buf->Size;
+    buf->resize(off + (int)data_size);
+    memcpy(buf->Data + off, data, data_size);
+}
+
+static ImU32 SettingsBinaryReadU32(const char* data)
+{
+    ImU32 v;
+    memcpy(&v, data, sizeof(v));
+    return v;
+}
+
 void ImGui::MarkIniSettingsDirty()
 {
     ImGuiContext& g = *GImGui;
@@ -9382,16 +10354,16 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     ImGuiWindowSettings* settings = &g.SettingsWindows.back();
     settings->Name = ImStrdup(name);
     settings->ID = ImHashStr(name);
+    g.SettingsWindowsMap.SetInt(settings->ID, g.SettingsWindows.Size - 1);
     return settings;
 }
 
+// Lookup is O(1) through SettingsWindowsMap, this is called for every entry when loading the .ini file.
 ImGuiWindowSettings* ImGui::FindWindowSettings(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (int i = 0; i != g.SettingsWindows.Size; i++)
-        if (g.SettingsWindows[i].ID == id)
-            return &g.SettingsWindows[i];
-    return NULL;
+    int idx = g.SettingsWindowsMap.GetInt(id, -1);
+    return (idx != -1) ? &g.SettingsWindows[idx] : NULL;
 }
 
 ImGuiWindowSettings* ImGui::FindOrCreateWindowSettings(const char* name)
@@ -9428,6 +10400,14 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
     IM_ASSERT(g.Initialized);
     IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
 
+    // Binary settings (see LoadBinarySettingsFromMemory) are detected from their header.
+    if (ini_size >= SETTINGS_BINARY_HEADER_SIZE && memcmp(ini_data, SETTINGS_BINARY_MAGIC, 4) == 0)
+    {
+        if (!LoadBinarySettingsFromMemory(ini_data, ini_size))
+            g.SettingsLoaded = true;
+        return;
+    }
+
     // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
     // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
     if (ini_size == 0)
@@ -9490,6 +10470,7 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
     if (!ini_filename)
         return;
 
+    ImU64 t0 = ImGetTimeNs();
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
     FILE* f = ImFileOpen(ini_filename, "wt");
@@ -9497,12 +10478,14 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
         return;
     fwrite(ini_data, sizeof(char), ini_data_size, f);
     fclose(f);
+    g.SettingsSaveToDiskMs = (float)((ImGetTimeNs() - t0) / 1000000.0);
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
+    ImU64 t0 = ImGetTimeNs();
     g.SettingsDirtyTimer = 0.0f;
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
@@ -9511,16 +10494,108 @@ const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
         ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
         handler->WriteAllFn(&g, handler, &g.SettingsIniData);
     }
+    g.SettingsSaveCount++;
+    g.SettingsSaveToMemoryMs = (float)((ImGetTimeNs() - t0) / 1000000.0);
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
     return g.SettingsIniData.c_str();
 }
 
+// Zero-tolerance: the whole data is validated before loading anything
+bool ImGui::LoadBinarySettingsFromMemory(const void* data_p, size_t data_size)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+
+    const char* data = (const char*)data_p;
+    const char* data_end = data + data_size;
+    if (data_size < SETTINGS_BINARY_HEADER_SIZE || memcmp(data, SETTINGS_BINARY_MAGIC, 4) != 0 || SettingsBinaryReadU32(data + 4) != SETTINGS_BINARY_VERSION)
+        return false;
+    const ImU32 sections_count = SettingsBinaryReadU32(data + 8);
+    const char* sections_start = data + SETTINGS_BINARY_HEADER_SIZE;
+    const char* section = sections_start;
+    for (ImU32 section_n = 0; section_n < sections_count; section_n++)
+    {
+        if ((size_t)(data_end - section) < SETTINGS_BINARY_SECTION_HEADER_SIZE)
+            return false;
+        const ImU32 section_size = SettingsBinaryReadU32(section + 8);
+        if ((size_t)(data_end - section) - SETTINGS_BINARY_SECTION_HEADER_SIZE < section_size)
+            return false;
+        section += SETTINGS_BINARY_SECTION_HEADER_SIZE + section_size;
+    }
+
+    // Binary sections are loaded directly, text sections are gathered and parsed together
+    ImGuiTextBuffer text_sections;
+    section = sections_start;
+    for (ImU32 section_n = 0; section_n < sections_count; section_n++)
+    {
+        const ImU32 type_hash = SettingsBinaryReadU32(section);
+        const ImU32 format = SettingsBinaryReadU32(section + 4);
+        const char* section_data = section + SETTINGS_BINARY_SECTION_HEADER_SIZE;
+        const char* section_data_end = section_data + SettingsBinaryReadU32(section + 8);
+        section = section_data_end;
+
+        ImGuiSettingsHandler* handler = NULL;
+        for (int handler_n = 0; handler_n < g.SettingsHandlers.Size && handler == NULL; handler_n++)
+            if (g.SettingsHandlers[handler_n].TypeHash == type_hash)
+                handler = &g.SettingsHandlers[handler_n];
+        if (handler == NULL)
+            continue;
+        if (format == SettingsBinaryFormat_Text)
+            text_sections.append(section_data, section_data_end);
+        else if (format == SettingsBinaryFormat_Binary && handler->ReadBinaryFn != NULL)
+            handler->ReadBinaryFn(&g, handler, section_data, section_data_end);
+    }
+    if (!text_sections.empty())
+        LoadIniSettingsFromMemory(text_sections.c_str(), (size_t)text_sections.size());
+    g.SettingsLoaded = true;
+    return true;
+}
+
+// Call registered handlers (e.g. SettingsHandlerWindow_WriteBinary() + custom handlers) to write their stuff into a binary buffer
+const void* ImGui::SaveBinarySettingsToMemory(size_t* out_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImU64 t0 = ImGetTimeNs();
+    g.SettingsDirtyTimer = 0.0f;
+    ImVector<char>& buf = g.SettingsBinaryData;
+    buf.resize(0);
+    const ImU32 header[2] = { SETTINGS_BINARY_VERSION, (ImU32)g.SettingsHandlers.Size };
+    SettingsBinaryAppend(&buf, SETTINGS_BINARY_MAGIC, 4);
+    SettingsBinaryAppend(&buf, header, sizeof(header));
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+    {
+        ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
+        const int section_offset = buf.Size;
+        ImU32 section_header[3] = { handler->TypeHash, handler->WriteBinaryFn ? SettingsBinaryFormat_Binary : SettingsBinaryFormat_Text, 0 };
+        SettingsBinaryAppend(&buf, section_header, sizeof(section_header));
+        if (handler->WriteBinaryFn)
+        {
+            handler->WriteBinaryFn(&g, handler, &buf);
+        }
+        else
+        {
+            ImGuiTextBuffer text;
+            handler->WriteAllFn(&g, handler, &text);
+            SettingsBinaryAppend(&buf, text.begin(), (size_t)text.size());
+        }
+        section_header[2] = (ImU32)(buf.Size - section_offset - (int)SETTINGS_BINARY_SECTION_HEADER_SIZE);
+        memcpy(buf.Data + section_offset, section_header, sizeof(section_header));
+    }
+    g.SettingsSaveCount++;
+    g.SettingsSaveToMemoryMs = (float)((ImGetTimeNs() - t0) / 1000000.0);
+    if (out_size)
+        *out_size = (size_t)buf.Size;
+    return buf.Data;
+}
+
 static void* SettingsHandlerWindow_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
 {
     ImGuiWindowSettings* settings = ImGui::FindWindowSettings(ImHashStr(name));
     if (!settings)
         settings = ImGui::CreateNewWindowSettings(name);
+    settings->WantSerialize = true;
     return (void*)settings;
 }
 
@@ -9535,10 +10610,10 @@ static void SettingsHandlerWindow_ReadLine(ImGuiContext* ctx, ImGuiSettingsHandl
     else if (sscanf(line, "Collapsed=%d", &i) == 1)     settings->Collapsed = (i != 0);
 }
 
-static void SettingsHandlerWindow_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void SettingsHandlerWindow_UpdateFromWindows(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (int i = 0; i != g.Windows.Size; i++)
     {
@@ -9553,30 +10628,583 @@ static void SettingsHandlerWindow_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsIdx = g.SettingsWindows.index_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
+        if (settings->Pos.x != window->Pos.x || settings->Pos.y != window->Pos.y || settings->Size.x != window->SizeFull.x || settings->Size.y != window->SizeFull.y || settings->Collapsed != window->Collapsed)
+            settings->WantSerialize = true;
         settings->Pos = window->Pos;
         settings->Size = window->SizeFull;
         settings->Collapsed = window->Collapsed;
     }
+}
+
+static void SettingsHandlerWindow_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    SettingsHandlerWindow_UpdateFromWindows(ctx);
+
+    // Serialize entries into our cache. Entries which didn't change since the last save are copied from the previous cache,
+    // so the cost of a save is mostly a memcpy() when only a few windows moved.
+    ImGuiTextBuffer prev_cache;
+    prev_cache.Buf.swap(g.SettingsWindowsIniCache.Buf);
+    ImGuiTextBuffer* cache = &g.SettingsWindowsIniCache;
+    cache->reserve(prev_cache.size() + 1);
+    g.SettingsSaveSerializedCount = 0;
+    for (int i = 0; i != g.SettingsWindows.Size; i++)
+    {
+        ImGuiWindowSettings* settings = &g.SettingsWindows[i];
+        const int offset = cache->size();
+        if (settings->Pos.x != FLT_MAX && !settings->WantSerialize && settings->IniCacheSize > 0)
+        {
+            const char* prev_data = prev_cache.begin() + settings->IniCacheOffset;
+            cache->append(prev_data, prev_data + settings->IniCacheSize);
+        }
+        else if (settings->Pos.x != FLT_MAX)
+        {
+            const char* name = settings->Name;
+            if (const char* p = strstr(name, "###"))  // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
+                name = p;
+            cache->appendf("[%s][%s]\n", handler->TypeName, name);
+            cache->appendf("Pos=%d,%d\n", (int)settings->Pos.x, (int)settings->Pos.y);
+            cache->appendf("Size=%d,%d\n", (int)settings->Size.x, (int)settings->Size.y);
+            cache->appendf("Collapsed=%d\n", settings->Collapsed);
+            cache->appendf("\n");
+            g.SettingsSaveSerializedCount++;
+        }
+        settings->WantSerialize = false;
+        settings->IniCacheOffset = offset;
+        settings->IniCacheSize = cache->size() - offset;
+    }
 
     // Write to text buffer
-    buf->reserve(buf->size() + g.SettingsWindows.Size * 96); // ballpark reserve
+    buf->append(cache->begin(), cache->end());
+}
+
+// Binary entry: ImU32 ID, float Pos[2], float Size[2], ImU8 Collapsed, ImU16 NameSize, char Name[NameSize] (zero-terminated)
+static void SettingsHandlerWindow_ReadBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, const char* data, const char* data_end)
+{
+    ImGuiContext& g = *ctx;
+    const size_t entry_header_size = sizeof(ImU32) + sizeof(float) * 4 + sizeof(ImU8) + sizeof(ImU16);
+    while ((size_t)(data_end - data) >= entry_header_size)
+    {
+        ImU32 id;
+        float pos_size[4];
+        ImU8 collapsed;
+        ImU16 name_size;
+        memcpy(&id, data, sizeof(id)); data += sizeof(id);
+        memcpy(pos_size, data, sizeof(pos_size)); data += sizeof(pos_size);
+        memcpy(&collapsed, data, sizeof(collapsed)); data += sizeof(collapsed);
+        memcpy(&name_size, data, sizeof(name_size)); data += sizeof(name_size);
+        if (name_size == 0 || data_end - data < name_size || data[name_size - 1] != 0)
+            return;
+        const char* name = data;
+        data += name_size;
+
+        ImGuiWindowSettings* settings = ImGui::FindWindowSettings(id);
+        if (!settings)
+            settings = ImGui::CreateNewWindowSettings(name);
+        settings->Pos = ImVec2(pos_size[0], pos_size[1]);
+        settings->Size = ImMax(ImVec2(pos_size[2], pos_size[3]), g.Style.WindowMinSize);
+        settings->Collapsed = (collapsed != 0);
+        settings->WantSerialize = true;
+    }
+}
+
+static void SettingsHandlerWindow_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImVector<char>* buf)
+{
+    ImGuiContext& g = *ctx;
+    SettingsHandlerWindow_UpdateFromWindows(ctx);
     for (int i = 0; i != g.SettingsWindows.Size; i++)
     {
         const ImGuiWindowSettings* settings = &g.SettingsWindows[i];
         if (settings->Pos.x == FLT_MAX)
             continue;
         const char* name = settings->Name;
-        if (const char* p = strstr(name, "###"))  // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
+        if (const char* p = strstr(name, "###"))  // Skip to the "###" marker if any, same as the text format.
             name = p;
-        buf->appendf("[%s][%s]\n", handler->TypeName, name);
-        buf->appendf("Pos=%d,%d\n", (int)settings->Pos.x, (int)settings->Pos.y);
-        buf->appendf("Size=%d,%d\n", (int)settings->Size.x, (int)settings->Size.y);
-        buf->appendf("Collapsed=%d\n", settings->Collapsed);
-        buf->appendf("\n");
+        const size_t name_size = strlen(name) + 1;
+        if (name_size > 0xFFFF)
+            continue;
+        const float pos_size[4] = { settings->Pos.x, settings->Pos.y, settings->Size.x, settings->Size.y };
+        const ImU8 collapsed = settings->Collapsed ? 1 : 0;
+        const ImU16 name_size_u16 = (ImU16)name_size;
+        SettingsBinaryAppend(buf, &settings->ID, sizeof(settings->ID));
+        SettingsBinaryAppend(buf, pos_size, sizeof(pos_size));
+        SettingsBinaryAppend(buf, &collapsed, sizeof(collapsed));
+        SettingsBinaryAppend(buf, &name_size_u16, sizeof(name_size_u16));
+        SettingsBinaryAppend(buf, name, name_size);
     }
 }
 
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - Opt-in, enabled with g.ProfilerEnabled (e.g. from the Metrics window).
+// - Records hierarchical scopes into a ring buffer of the last g.ProfilerFramesCount frames.
+// - Storage is reused across frames, so recording doesn't allocate once the buffers have grown to the frame contents.
+//-----------------------------------------------------------------------------
+
+// Called by NewFrame()
+static void ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    g.ProfilerScopeStack.resize(0);
+    g.ProfilerActive = g.ProfilerEnabled && g.ProfilerFramesCount > 0;
+    if (!g.ProfilerActive)
+        return;
+
+    // (Re)allocate ring buffer. ImVector<> doesn't call constructors/destructors so we free the scopes storage ourselves.
+    if (g.ProfilerFrames.Size != g.ProfilerFramesCount)
+    {
+        for (int i = 0; i < g.ProfilerFrames.Size; i++)
+            g.ProfilerFrames[i].Scopes.clear();
+        g.ProfilerFrames.resize(0);
+        g.ProfilerFrames.resize(g.ProfilerFramesCount, ImGuiProfilerFrame());
+        g.ProfilerFrameIdx = -1;
+    }
+    g.ProfilerFrameIdx = (g.ProfilerFrameIdx + 1) % g.ProfilerFrames.Size;
+    ImGuiProfilerFrame& frame = g.ProfilerFrames[g.ProfilerFrameIdx];
+    frame.FrameCount = g.FrameCount;
+    frame.StartNs = frame.EndNs = ImGetTimeNs();
+    frame.Scopes.resize(0);
+}
+
+void ImGui::ProfilerBeginScope(const char* name)
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.ProfilerActive)
+        return;
+    ImGuiProfilerFrame& frame = g.ProfilerFrames[g.ProfilerFrameIdx];
+    ImGuiProfilerScope scope;
+    scope.Name = name;
+    scope.StartNs = ImGetTimeNs();
+    scope.EndNs = 0;
+    scope.Depth = g.ProfilerScopeStack.Size;
+    g.ProfilerScopeStack.push_back(frame.Scopes.Size);
+    frame.Scopes.push_back(scope);
+}
+
+void ImGui::ProfilerEndScope()
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.ProfilerActive || g.ProfilerScopeStack.empty())
+        return;
+    ImGuiProfilerFrame& frame = g.ProfilerFrames[g.ProfilerFrameIdx];
+    ImGuiProfilerScope& scope = frame.Scopes[g.ProfilerScopeStack.back()];
+    g.ProfilerScopeStack.pop_back();
+    scope.EndNs = ImGetTimeNs();
+    if (scope.Depth == 0)
+        frame.EndNs = scope.EndNs;
+}
+
+ImGuiProfilerFrame* ImGui::ProfilerGetFrame(int frames_ago)
+{
+    ImGuiContext& g = *GImGui;
+    if (frames_ago < 0 || frames_ago >= g.ProfilerFrames.Size)
+        return NULL;
+    ImGuiProfilerFrame* frame = &g.ProfilerFrames[(g.ProfilerFrameIdx - frames_ago + g.ProfilerFrames.Size) % g.ProfilerFrames.Size];
+    return (frame->FrameCount >= 0) ? frame : NULL;
+}
+
+static void ProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* str)
+{
+    buf->append("\"");
+    for (const char* p = str; *p; p++)
+    {
+        const unsigned char c = (unsigned char)*p;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else if (c < 0x20)
+            buf->appendf("\\u%04x", c);
+        else
+            buf->append(p, p + 1);
+    }
+    buf->append("\"");
+}
+
+// Output one complete ("ph":"X") event per recorded scope, plus one per frame. Timestamps are in microseconds relative to the oldest recorded frame.
+void ImGui::ProfilerExportChromeTrace(ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *GImGui;
+    buf->append("{\"traceEvents\":[");
+    bool first_event = true;
+    ImU64 base_ns = 0;
+    for (int frames_ago = g.ProfilerFrames.Size - 1; frames_ago >= 0; frames_ago--)
+    {
+        const ImGuiProfilerFrame* frame = ProfilerGetFrame(frames_ago);
+        if (frame == NULL || (g.ProfilerActive && frames_ago == 0)) // Skip current frame if still recording
+            continue;
+        if (base_ns == 0)
+            base_ns = frame->StartNs;
+        buf->appendf("%s\n{\"name\":\"Frame %d\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+            first_event ? "" : ",", frame->FrameCount, (frame->StartNs - base_ns) / 1000.0, (frame->EndNs - frame->StartNs) / 1000.0);
+        first_event = false;
+        for (int scope_n = 0; scope_n < frame->Scopes.Size; scope_n++)
+        {
+            const ImGuiProfilerScope& scope = frame->Scopes[scope_n];
+            if (scope.EndNs == 0)
+                continue;
+            buf->append(",\n{\"name\":");
+            ProfilerAppendJsonString(buf, scope.Name);
+            buf->appendf(",\"cat\":\"imgui\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d}}",
+                (scope.StartNs - base_ns) / 1000.0, (scope.EndNs - scope.StartNs) / 1000.0, frame->FrameCount);
+        }
+    }
+    buf->append("\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+bool ImGui::ProfilerExportChromeTraceToDisk(const char* filename)
+{
+    ImGuiTextBuffer buf;
+    ProfilerExportChromeTrace(&buf);
+    FILE* f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = fwrite(buf.begin(), sizeof(char), (size_t)buf.size(), f) == (size_t)buf.size();
+    fclose(f);
+    return ret;
+}
+
+
+//-----------------------------------------------------------------------------
+// [SECTION] ALLOCATION AUDIT
+//-----------------------------------------------------------------------------
+// - Opt-in, enabled with g.AllocAuditMode (e.g. from the Metrics window).
+// - Frames are allowed to allocate during warm-up, after which MemAlloc() records (or asserts on) every call.
+// - Recording uses fixed size storage, so the audit itself never allocates.
+//-----------------------------------------------------------------------------
+
+// Called by NewFrame()
+static void AllocAuditNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.AllocAuditMode == ImGuiAllocAuditMode_None)
+    {
+        g.AllocAuditStartFrame = -1;
+        g.AllocAuditActive = false;
+        return;
+    }
+    if (g.AllocAuditStartFrame == -1)
+        ImGui::AllocAuditRestart();
+    if (!g.AllocAuditActive && g.FrameCount - g.AllocAuditStartFrame >= g.AllocAuditWarmupFrames)
+    {
+        // End of warm-up
+        if (g.AllocReserveHeadroom > 0.0f)
+            ImGui::AllocReserveFrameBuffers(g.AllocReserveHeadroom);
+        g.AllocAuditActive = true;
+    }
+}
+
+// Called by MemAlloc() while auditing
+static void AllocAuditRecordAlloc(ImGuiContext* ctx, size_t size)
+{
+    ImGuiContext& g = *ctx;
+    if (!g.AllocAuditActive)
+    {
+        g.AllocAuditWarmupAllocsCount++;
+        g.AllocAuditWarmupAllocsBytes += size;
+        g.AllocAuditHighWaterMark = ImMax(g.AllocAuditHighWaterMark, g.IO.MetricsActiveAllocations);
+        return;
+    }
+    ImGuiAllocAuditRecord& record = g.AllocAuditRecords[g.AllocAuditViolationsCount % IM_ARRAYSIZE(g.AllocAuditRecords)];
+    record.FrameCount = g.FrameCount;
+    record.Size = size;
+    record.Tag = g.AllocAuditTag;
+    record.WindowName = g.CurrentWindow ? g.CurrentWindow->Name : NULL;
+    g.AllocAuditViolationsCount++;
+    IM_ASSERT(g.AllocAuditMode != ImGuiAllocAuditMode_Assert && "Heap allocation after warm-up. See g.AllocAuditRecords[] or the Metrics window for the callsite.");
+}
+
+void ImGui::AllocAuditRestart()
+{
+    ImGuiContext& g = *GImGui;
+    g.AllocAuditStartFrame = g.FrameCount;
+    g.AllocAuditActive = false;
+    g.AllocAuditWarmupAllocsCount = g.AllocAuditHighWaterMark = g.AllocAuditViolationsCount = 0;
+    g.AllocAuditWarmupAllocsBytes = 0;
+    memset(g.AllocAuditRecords, 0, sizeof(g.AllocAuditRecords));
+}
+
+// The capacity of a buffer reused every frame is the high-water mark of its contents, reserve 'headroom' on top of it
+// so that contents slightly larger than anything seen so far don't allocate.
+static void AllocReserveDrawListBuffers(ImDrawList* draw_list, float headroom)
+{
+    draw_list->ReserveBuffers((int)(draw_list->IdxBuffer.Capacity * (1.0f + headroom)) - draw_list->IdxBuffer.Size, (int)(draw_list->VtxBuffer.Capacity * (1.0f + headroom)) - draw_list->VtxBuffer.Size);
+    draw_list->CmdBuffer.reserve((int)(draw_list->CmdBuffer.Capacity * (1.0f + headroom)));
+}
+
+void ImGui::AllocReserveFrameBuffers(float headroom)
+{
+    ImGuiContext& g = *GImGui;
+    for (int i = 0; i != g.Windows.Size; i++)
+        if (!g.Windows[i]->MemoryCompacted)
+            AllocReserveDrawListBuffers(g.Windows[i]->DrawList, headroom);
+    AllocReserveDrawListBuffers(&g.BackgroundDrawList, headroom);
+    AllocReserveDrawListBuffers(&g.ForegroundDrawList, headroom);
+    for (int n = 0; n < IM_ARRAYSIZE(g.DrawDataBuilder.Layers); n++)
+        g.DrawDataBuilder.Layers[n].reserve((int)(g.DrawDataBuilder.Layers[n].Capacity * (1.0f + headroom)));
+    for (int n = 0; n < g.TabBars.GetSize(); n++)
+    {
+        ImGuiTextBuffer& tabs_names = g.TabBars.GetByIndex(n)->TabsNames;
+        tabs_names.reserve((int)(tabs_names.Buf.Capacity * (1.0f + headroom)));
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// [SECTION] MEMORY ACCOUNTING
+//-----------------------------------------------------------------------------
+// - Opt-in, enabled with g.MemoryTagsEnabled (e.g. from the Metrics window).
+// - MemAlloc()/MemFree() maintain a hash table of the live allocations and their size. MemFree() ignores the pointers it doesn't know
+//   (allocated before tracking was enabled, or while another context was current).
+// - New allocations are counted in ImGuiMemoryTag_Other. Once per frame, NewFrame() walks the structures owned by each subsystem
+//   and window, and moves the allocations it finds to their subsystem. This keeps MemAlloc() unaware of its callers.
+//-----------------------------------------------------------------------------
+
+static const char* GMemoryTagNames[ImGuiMemoryTag_COUNT] = { "Other", "Windows", "DrawLists", "FontAtlas", "Storage", "InputText", "Settings", "Columns" };
+
+const char* ImGui::MemoryTagGetName(ImGuiMemoryTag tag)
+{
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemoryTag_COUNT);
+    return GMemoryTagNames[tag];
+}
+
+static inline int MemoryAllocHomeSlot(const ImGuiContext& g, const void* ptr)
+{
+    // Low bits are zero because of alignment: mix them away
+    ImU32 h = (ImU32)((size_t)ptr >> 4) ^ (ImU32)((ImU64)(size_t)ptr >> 32);
+    h *= 0x9E3779B1u;
+    return (int)(h ^ (h >> 16)) & (g.MemoryAllocsCapacity - 1);
+}
+
+// Slot holding 'ptr', or empty slot where it would be inserted
+static int MemoryFindAllocSlot(const ImGuiContext& g, const void* ptr)
+{
+    const int mask = g.MemoryAllocsCapacity - 1;
+    int slot = MemoryAllocHomeSlot(g, ptr);
+    while (g.MemoryAllocs[slot].Ptr != NULL && g.MemoryAllocs[slot].Ptr != ptr)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+static ImGuiMemoryAlloc* MemoryFindAlloc(ImGuiContext& g, const void* ptr)
+{
+    if (ptr == NULL || g.MemoryAllocsCount == 0)
+        return NULL;
+    ImGuiMemoryAlloc* alloc = &g.MemoryAllocs[MemoryFindAllocSlot(g, ptr)];
+    return alloc->Ptr ? alloc : NULL;
+}
+
+static void MemoryTagAddBytes(ImGuiContext& g, ImGuiMemoryTag tag, size_t size)
+{
+    ImGuiMemoryTagStats& stats = g.MemoryTagStats[tag];
+    stats.LiveBytes += size;
+    stats.LiveCount++;
+    stats.PeakBytes = ImMax(stats.PeakBytes, stats.LiveBytes);
+}
+
+static void MemoryTagSubBytes(ImGuiContext& g, ImGuiMemoryTag tag, size_t size)
+{
+    ImGuiMemoryTagStats& stats = g.MemoryTagStats[tag];
+    stats.LiveBytes -= size;
+    stats.LiveCount--;
+}
+
+// Called by MemAlloc() while tracking.
+// The table is allocated with the allocator functions directly, so this is never reentrant.
+static void MemoryTrackAlloc(ImGuiContext* ctx, void* ptr, size_t size)
+{
+    ImGuiContext& g = *ctx;
+    if (ptr == NULL)
+        return;
+    if ((g.MemoryAllocsCount + 1) * 2 > g.MemoryAllocsCapacity)
+    {
+        // Keep the load factor under 50%
+        const int new_capacity = ImMax(g.MemoryAllocsCapacity * 2, 1024);
+        ImGuiMemoryAlloc* new_allocs = (ImGuiMemoryAlloc*)GImAllocatorAllocFunc((size_t)new_capacity * sizeof(ImGuiMemoryAlloc), GImAllocatorUserData);
+        if (new_allocs == NULL)
+            return;
+        memset(new_allocs, 0, (size_t)new_capacity * sizeof(ImGuiMemoryAlloc));
+        ImGuiMemoryAlloc* old_allocs = g.MemoryAllocs;
+        const int old_capacity = g.MemoryAllocsCapacity;
+        g.MemoryAllocs = new_allocs;
+        g.MemoryAllocsCapacity = new_capacity;
+        for (int n = 0; n < old_capacity; n++)
+            if (old_allocs[n].Ptr != NULL)
+                g.MemoryAllocs[MemoryFindAllocSlot(g, old_allocs[n].Ptr)] = old_allocs[n];
+        if (old_allocs != NULL)
+            GImAllocatorFreeFunc(old_allocs, GImAllocatorUserData);
+    }
+
+    ImGuiMemoryAlloc& alloc = g.MemoryAllocs[MemoryFindAllocSlot(g, ptr)];
+    if (alloc.Ptr != NULL)
+        MemoryTagSubBytes(g, alloc.Tag, alloc.Size);    // Stale entry: freed while another context was current, then reused by the allocator
+    else
+        g.MemoryAllocsCount++;
+    alloc.Ptr = ptr;
+    alloc.Size = size;
+    alloc.Tag = ImGuiMemoryTag_Other;
+    MemoryTagAddBytes(g, alloc.Tag, size);
+}
+
+// Called by MemFree() while some allocations are tracked
+static void MemoryTrackFree(ImGuiContext* ctx, void* ptr)
+{
+    ImGuiContext& g = *ctx;
+    int slot = MemoryFindAllocSlot(g, ptr);
+    if (g.MemoryAllocs[slot].Ptr == NULL)
+        return;
+    MemoryTagSubBytes(g, g.MemoryAllocs[slot].Tag, g.MemoryAllocs[slot].Size);
+    g.MemoryAllocsCount--;
+
+    // Backward shift deletion: move the following entries of the cluster into the hole when it is between their home slot and them
+    const int mask = g.MemoryAllocsCapacity - 1;
+    for (int next_slot = (slot + 1) & mask; g.MemoryAllocs[next_slot].Ptr != NULL; next_slot = (next_slot + 1) & mask)
+    {
+        const int home_slot = MemoryAllocHomeSlot(g, g.MemoryAllocs[next_slot].Ptr);
+        if (((next_slot - home_slot) & mask) >= ((next_slot - slot) & mask))
+        {
+            g.MemoryAllocs[slot] = g.MemoryAllocs[next_slot];
+            slot = next_slot;
+        }
+    }
+    g.MemoryAllocs[slot].Ptr = NULL;
+}
+
+static void MemoryClearAllocs(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    if (g.MemoryAllocs != NULL)
+        GImAllocatorFreeFunc(g.MemoryAllocs, GImAllocatorUserData);
+    g.MemoryAllocs = NULL;
+    g.MemoryAllocsCapacity = g.MemoryAllocsCount = 0;
+    memset(g.MemoryTagStats, 0, sizeof(g.MemoryTagStats));
+    for (int i = 0; i != g.Windows.Size; i++)
+        memset(g.Windows[i]->MemoryTagsBytes, 0, sizeof(g.Windows[i]->MemoryTagsBytes));
+}
+
+// Move a tracked allocation to the subsystem owning it. Return its size, 0 if not tracked.
+static int MemoryAttribute(ImGuiContext& g, const void* ptr, ImGuiMemoryTag tag)
+{
+    ImGuiMemoryAlloc* alloc = MemoryFindAlloc(g, ptr);
+    if (alloc == NULL)
+        return 0;
+    if (alloc->Tag != tag)
+    {
+        MemoryTagSubBytes(g, alloc->Tag, alloc->Size);
+        MemoryTagAddBytes(g, tag, alloc->Size);
+        alloc->Tag = tag;
+    }
+    return (int)alloc->Size;
+}
+
+static int MemoryAttributeStorage(ImGuiContext& g, const ImGuiStorage& storage, ImGuiMemoryTag tag)
+{
+    return MemoryAttribute(g, storage.Data.Data, tag) + MemoryAttribute(g, storage.HashIndex.Data, tag);
+}
+
+static int MemoryAttributeDrawList(ImGuiContext& g, const ImDrawList* draw_list)
+{
+    const ImGuiMemoryTag tag = ImGuiMemoryTag_DrawLists;
+    int bytes = MemoryAttribute(g, draw_list->CmdBuffer.Data, tag) + MemoryAttribute(g, draw_list->IdxBuffer.Data, tag) + MemoryAttribute(g, draw_list->VtxBuffer.Data, tag);
+    bytes += MemoryAttribute(g, draw_list->_ClipRectStack.Data, tag) + MemoryAttribute(g, draw_list->_TextureIdStack.Data, tag) + MemoryAttribute(g, draw_list->_Path.Data, tag);
+    bytes += MemoryAttribute(g, draw_list->_DeferredPrims.Data, tag) + MemoryAttribute(g, draw_list->_DeferredPoints.Data, tag);
+    bytes += MemoryAttribute(g, draw_list->_Splitter._Channels.Data, tag);
+    for (int n = 0; n < draw_list->_Splitter._Channels.Size; n++)
+        if (n != draw_list->_Splitter._Current) // Current channel is a copy of CmdBuffer/IdxBuffer
+            bytes += MemoryAttribute(g, draw_list->_Splitter._Channels[n].CmdBuffer.Data, tag) + MemoryAttribute(g, draw_list->_Splitter._Channels[n].IdxBuffer.Data, tag);
+    return bytes;
+}
+
+static void MemoryAttributeWindow(ImGuiContext& g, ImGuiWindow* window)
+{
+    int* bytes = window->MemoryTagsBytes;
+    memset(window->MemoryTagsBytes, 0, sizeof(window->MemoryTagsBytes));
+    const ImGuiMemoryTag tag = ImGuiMemoryTag_Windows;
+    bytes[tag] += MemoryAttribute(g, window, tag) + MemoryAttribute(g, window->Name, tag) + MemoryAttribute(g, window->IDStack.Data, tag);
+    bytes[tag] += MemoryAttribute(g, window->DC.ChildWindows.Data, tag) + MemoryAttribute(g, window->DC.ItemFlagsStack.Data, tag) + MemoryAttribute(g, window->DC.ItemWidthStack.Data, tag);
+    bytes[tag] += MemoryAttribute(g, window->DC.TextWrapPosStack.Data, tag) + MemoryAttribute(g, window->DC.GroupStack.Data, tag);
+
+    ImDrawListRetainedData* retained = &window->RetainedDrawList;
+    bytes[ImGuiMemoryTag_DrawLists] += MemoryAttributeDrawList(g, window->DrawList) + MemoryAttribute(g, window->DrawListsAttached.Data, ImGuiMemoryTag_DrawLists);
+    bytes[ImGuiMemoryTag_DrawLists] += MemoryAttribute(g, retained->PrevPrims.Data, ImGuiMemoryTag_DrawLists) + MemoryAttribute(g, retained->Prims.Data, ImGuiMemoryTag_DrawLists);
+    bytes[ImGuiMemoryTag_Storage] += MemoryAttributeStorage(g, window->StateStorage, ImGuiMemoryTag_Storage);
+    bytes[ImGuiMemoryTag_Columns] += MemoryAttribute(g, window->ColumnsStorage.Data, ImGuiMemoryTag_Columns);
+    for (int n = 0; n < window->ColumnsStorage.Size; n++)
+        bytes[ImGuiMemoryTag_Columns] += MemoryAttribute(g, window->ColumnsStorage[n].Columns.Data, ImGuiMemoryTag_Columns);
+}
+
+static void MemoryAttributeFontAtlas(ImGuiContext& g, const ImFontAtlas* atlas)
+{
+    const ImGuiMemoryTag tag = ImGuiMemoryTag_FontAtlas;
+    MemoryAttribute(g, atlas, tag);
+    MemoryAttribute(g, atlas->TexPixelsAlpha8, tag);
+    MemoryAttribute(g, atlas->TexPixelsRGBA32, tag);
+    MemoryAttribute(g, atlas->DynamicData, tag);
+    MemoryAttribute(g, atlas->CustomRects.Data, tag);
+    MemoryAttribute(g, atlas->ConfigData.Data, tag);
+    for (int n = 0; n < atlas->ConfigData.Size; n++)
+        if (atlas->ConfigData[n].FontDataOwnedByAtlas)
+            MemoryAttribute(g, atlas->ConfigData[n].FontData, tag);
+    MemoryAttribute(g, atlas->Fonts.Data, tag);
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+    {
+        const ImFont* font = atlas->Fonts[n];
+        MemoryAttribute(g, font, tag);
+        MemoryAttribute(g, font->IndexAdvanceX.Data, tag);
+        MemoryAttribute(g, font->IndexLookup.Data, tag);
+        MemoryAttribute(g, font->IndexPages.Data, tag);
+        MemoryAttribute(g, font->Glyphs.Data, tag);
+    }
+}
+
+// Called by NewFrame()
+static void MemoryNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.MemoryTagsEnabled)
+    {
+        if (g.MemoryAllocs != NULL)
+            MemoryClearAllocs(&g);
+        return;
+    }
+    if (g.MemoryAllocsCount == 0)
+        return;
+
+    // Windows
+    MemoryAttribute(g, g.Windows.Data, ImGuiMemoryTag_Windows);
+    MemoryAttribute(g, g.WindowsFocusOrder.Data, ImGuiMemoryTag_Windows);
+    MemoryAttribute(g, g.WindowsSortBuffer.Data, ImGuiMemoryTag_Windows);
+    MemoryAttribute(g, g.CurrentWindowStack.Data, ImGuiMemoryTag_Windows);
+    for (int i = 0; i != g.Windows.Size; i++)
+        MemoryAttributeWindow(g, g.Windows[i]);
+
+    // Draw lists not owned by a window
+    MemoryAttributeDrawList(g, &g.BackgroundDrawList);
+    MemoryAttributeDrawList(g, &g.ForegroundDrawList);
+    MemoryAttributeDrawList(g, &g.FlattenedDrawList);
+    MemoryAttribute(g, g.ForegroundDrawListsAttached.Data, ImGuiMemoryTag_DrawLists);
+    MemoryAttribute(g, g.FlattenLists.Data, ImGuiMemoryTag_DrawLists);
+    for (int n = 0; n < IM_ARRAYSIZE(g.DrawDataBuilder.Layers); n++)
+        MemoryAttribute(g, g.DrawDataBuilder.Layers[n].Data, ImGuiMemoryTag_DrawLists);
+
+    // Other subsystems
+    if (g.IO.Fonts)
+        MemoryAttributeFontAtlas(g, g.IO.Fonts);
+    MemoryAttributeStorage(g, g.WindowsById, ImGuiMemoryTag_Storage);
+    MemoryAttribute(g, g.InputTextState.TextW.Data, ImGuiMemoryTag_InputText);
+    MemoryAttribute(g, g.InputTextState.TextA.Data, ImGuiMemoryTag_InputText);
+    MemoryAttribute(g, g.InputTextState.InitialTextA.Data, ImGuiMemoryTag_InputText);
+    MemoryAttribute(g, g.SettingsIniData.Buf.Data, ImGuiMemoryTag_Settings);
+    MemoryAttribute(g, g.SettingsBinaryData.Data, ImGuiMemoryTag_Settings);
+    MemoryAttribute(g, g.SettingsHandlers.Data, ImGuiMemoryTag_Settings);
+    MemoryAttribute(g, g.SettingsWindows.Data, ImGuiMemoryTag_Settings);
+    for (int n = 0; n < g.SettingsWindows.Size; n++)
+        MemoryAttribute(g, g.SettingsWindows[n].Name, ImGuiMemoryTag_Settings);
+    MemoryAttributeStorage(g, g.SettingsWindowsMap, ImGuiMemoryTag_Settings);
+    MemoryAttribute(g, g.SettingsWindowsIniCache.Buf.Data, ImGuiMemoryTag_Settings);
+}
+
+
 //-----------------------------------------------------------------------------
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 //-----------------------------------------------------------------------------
@@ -9595,7 +11223,7 @@ static void SettingsHandlerWindow_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
 // [SECTION] PLATFORM DEPENDENT HELPERS
 //-----------------------------------------------------------------------------
 
-#if defined(_WIN32) && !defined(_WINDOWS_) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && (!defined(IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS) || !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS))
+#if defined(_WIN32) && !defined(_WINDOWS_) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
 #ifndef WIN32_LEAN_AND_MEAN
 #define WIN32_LEAN_AND_MEAN
 #endif
@@ -9607,6 +11235,28 @@ static void SettingsHandlerWindow_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
 #elif defined(__APPLE__)
 #include <TargetConditionals.h>
 #endif
+#if !defined(_WIN32) || defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+#include <time.h>           // clock_gettime, clock
+#endif
+
+// Monotonic clock used for statistics displayed in the Metrics window. This never affects behavior (which only relies on io.DeltaTime).
+ImU64 ImGetTimeNs()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    static LARGE_INTEGER frequency = { 0 };
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)((double)counter.QuadPart * 1000000000.0 / (double)frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    return (ImU64)((double)clock() * 1000000000.0 / CLOCKS_PER_SEC);
+#endif
+}
 
 #if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS)
 
@@ -9776,6 +11426,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     static bool show_windows_rects = false;
     static int  show_windows_rect_type = RT_WorkRect;
     static bool show_drawcmd_clip_rects = true;
+    static bool show_occlusion_culling = false;
 
     ImGuiIO& io = ImGui::GetIO();
     ImGui::Text("Dear ImGui %s", ImGui::GetVersion());
@@ -9783,6 +11434,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
     ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
+    ImGui::Text("Windows memory: %d KB (peak %d KB), %d windows compacted", (GImGui->WindowsMemoryUsage + 1023) / 1024, (GImGui->WindowsMemoryUsagePeak + 1023) / 1024, GImGui->WindowsMemoryCompactedCount);
     ImGui::Separator();
 
     struct Funcs
@@ -9800,6 +11452,30 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             return ImRect();
         }
 
+        static int GetMemoryTagsBytes(const ImGuiWindow* window)
+        {
+            int bytes = 0;
+            for (int tag = 0; tag < ImGuiMemoryTag_COUNT; tag++)
+                bytes += window->MemoryTagsBytes[tag];
+            return bytes;
+        }
+
+        static int IMGUI_CDECL MemoryTagsBytesComparer(const void* lhs, const void* rhs)
+        {
+            return GetMemoryTagsBytes(*(const ImGuiWindow* const*)rhs) - GetMemoryTagsBytes(*(const ImGuiWindow* const*)lhs);
+        }
+
+        static void NodeMemoryTagsBytes(const ImGuiWindow* window)
+        {
+            char buf[256];
+            int buf_len = 0;
+            buf[0] = 0;
+            for (int tag = 0; tag < ImGuiMemoryTag_COUNT; tag++)
+                if (window->MemoryTagsBytes[tag] > 0)
+                    buf_len += ImFormatString(buf + buf_len, IM_ARRAYSIZE(buf) - buf_len, "%s%s %d", buf_len > 0 ? ", " : "", ImGui::MemoryTagGetName(tag), window->MemoryTagsBytes[tag]);
+            ImGui::BulletText("'%s': %d bytes (%s)", window->Name, GetMemoryTagsBytes(window), buf);
+        }
+
         static void NodeDrawList(ImGuiWindow* window, ImDrawList* draw_list, const char* label)
         {
             bool node_open = ImGui::TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->CmdBuffer.Size);
@@ -9856,9 +11532,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                         {
                             int vtx_i = idx_buffer ? idx_buffer[idx_i] : idx_i;
                             ImDrawVert& v = draw_list->VtxBuffer[vtx_i];
-                            triangles_pos[n] = v.pos;
+                            ImVec2 pos = v.pos, uv = v.uv;
+                            triangles_pos[n] = pos;
                             buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                                (n == 0) ? "elem" : "    ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                                (n == 0) ? "elem" : "    ", idx_i, pos.x, pos.y, uv.x, uv.y, v.col);
                         }
                         ImGui::Selectable(buf, false);
                         if (fg_draw_list && ImGui::IsItemHovered())
@@ -9893,12 +11570,22 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGui::TreePop();
         }
 
+        static void NodeRetainedDrawList(ImGuiWindow* window)
+        {
+            const ImDrawListRetainedData* retained = &window->RetainedDrawList;
+            const int prims = retained->ReusedCountTotal + retained->TessellatedCountTotal;
+            ImGui::BulletText("RetainedDrawList: %d/%d primitives reused this frame, %d reused, %d tessellated in total (%.1f%% reused)", retained->ReusedCount, retained->ReusedCount + retained->TessellatedCount,
+                retained->ReusedCountTotal, retained->TessellatedCountTotal, prims > 0 ? retained->ReusedCountTotal * 100.0f / prims : 0.0f);
+        }
+
         static void NodeWindow(ImGuiWindow* window, const char* label)
         {
             if (!ImGui::TreeNode(window, "%s '%s', %d @ 0x%p", label, window->Name, window->Active || window->WasActive, window))
                 return;
             ImGuiWindowFlags flags = window->Flags;
             NodeDrawList(window, window->DrawList, "DrawList");
+            if (window->DrawListsAttached.Size > 0)
+                ImGui::BulletText("DrawListsAttached: %d", window->DrawListsAttached.Size);
             ImGui::BulletText("Pos: (%.1f,%.1f), Size: (%.1f,%.1f), SizeContents (%.1f,%.1f)", window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->SizeContents.x, window->SizeContents.y);
             ImGui::BulletText("Flags: 0x%08X (%s%s%s%s%s%s%s%s%s..)", flags,
                 (flags & ImGuiWindowFlags_ChildWindow)  ? "Child " : "",      (flags & ImGuiWindowFlags_Tooltip)     ? "Tooltip "   : "",  (flags & ImGuiWindowFlags_Popup) ? "Popup " : "",
@@ -9922,7 +11609,12 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                     NodeColumns(&window->ColumnsStorage[n]);
                 ImGui::TreePop();
             }
-            ImGui::BulletText("Storage: %d bytes", window->StateStorage.Data.Size * (int)sizeof(ImGuiStorage::Pair));
+            ImGui::BulletText("Storage: %d bytes%s", window->StateStorage.Data.Size * (int)sizeof(ImGuiStorage::Pair) + window->StateStorage.HashIndex.Size * (int)sizeof(int), window->StateStorage.Hashed ? " (hashed)" : "");
+            ImGui::BulletText("Memory: %d bytes%s, last active %.1f sec ago", ImGui::GcCalcWindowMemoryUsage(window), window->MemoryCompacted ? " (compacted)" : "", (float)ImGui::GetTime() - window->LastTimeActive);
+            if (GImGui->MemoryTagsEnabled)
+                NodeMemoryTagsBytes(window);
+            if (flags & ImGuiWindowFlags_RetainDrawList)
+                NodeRetainedDrawList(window);
             ImGui::TreePop();
         }
 
@@ -9976,6 +11668,161 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGui::TreePop();
     }
 
+    if (ImGui::TreeNode("Settings", "Settings (%d window entries)", g.SettingsWindows.Size))
+    {
+        ImGui::Text("SettingsDirtyTimer: %.2f", g.SettingsDirtyTimer);
+        ImGui::Text("Saves: %d, last save serialized %d/%d window entries, %d bytes", g.SettingsSaveCount, g.SettingsSaveSerializedCount, g.SettingsWindows.Size, g.SettingsIniData.size());
+        ImGui::Text("Last SaveIniSettingsToMemory(): %.3f ms", g.SettingsSaveToMemoryMs);
+        ImGui::Text("Last SaveIniSettingsToDisk(): %.3f ms", g.SettingsSaveToDiskMs);
+        ImGui::TreePop();
+    }
+
+    int retained_windows_count = 0;
+    for (int n = 0; n < g.Windows.Size; n++)
+        if (g.Windows[n]->Flags & ImGuiWindowFlags_RetainDrawList)
+            retained_windows_count++;
+    if (ImGui::TreeNode("RetainedDrawLists", "Retained draw lists (%d windows)", retained_windows_count))
+    {
+        const int prims = g.RetainedDrawListsReusedCount + g.RetainedDrawListsTessellatedCount;
+        ImGui::Text("Total: %d primitives reused, %d tessellated (%.1f%% reused)", g.RetainedDrawListsReusedCount, g.RetainedDrawListsTessellatedCount, prims > 0 ? g.RetainedDrawListsReusedCount * 100.0f / prims : 0.0f);
+        for (int n = 0; n < g.Windows.Size; n++)
+        {
+            ImGuiWindow* window = g.Windows[n];
+            if (!(window->Flags & ImGuiWindowFlags_RetainDrawList))
+                continue;
+            ImGui::Text("'%s':", window->Name);
+            Funcs::NodeRetainedDrawList(window);
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Profiler"))
+    {
+        static int profiler_frames_ago = 0;
+        static float profiler_zoom = 1.0f;
+        ImGui::Checkbox("Enabled", &g.ProfilerEnabled);
+        ImGui::SameLine();
+        if (ImGui::Button("Export Chrome trace"))
+            ImGui::ProfilerExportChromeTraceToDisk("imgui_trace.json");
+        if (ImGui::IsItemHovered())
+            ImGui::SetTooltip("Write recorded frames to imgui_trace.json, open with chrome://tracing or ui.perfetto.dev");
+
+        // Frame selection (the frame being recorded is incomplete, start from the previous one)
+        const int frames_ago_base = g.ProfilerActive ? 1 : 0;
+        const int frames_ago_max = ImMax(0, g.ProfilerFrames.Size - 1 - frames_ago_base);
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12);
+        ImGui::SliderInt("Frames ago", &profiler_frames_ago, 0, frames_ago_max);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        ImGui::SliderFloat("Zoom", &profiler_zoom, 1.0f, 50.0f, "%.1fx", 2.0f);
+        profiler_frames_ago = ImClamp(profiler_frames_ago, 0, frames_ago_max);
+        ImGuiProfilerFrame* frame = ImGui::ProfilerGetFrame(profiler_frames_ago + frames_ago_base);
+        if (frame == NULL)
+        {
+            ImGui::TextDisabled("No recorded frame.");
+        }
+        else
+        {
+            const double frame_ms = (frame->EndNs - frame->StartNs) / 1000000.0;
+            int max_depth = 0;
+            for (int n = 0; n < frame->Scopes.Size; n++)
+                max_depth = ImMax(max_depth, frame->Scopes[n].Depth);
+            ImGui::Text("Frame %d: %.3f ms, %d scopes", frame->FrameCount, frame_ms, frame->Scopes.Size);
+
+            // Flame view: one row per depth, scopes width proportional to their duration
+            const float row_height = ImGui::GetTextLineHeight() + 2.0f;
+            const float avail_width = ImGui::GetContentRegionAvail().x;
+            ImGui::BeginChild("##flame", ImVec2(avail_width, row_height * (max_depth + 1) + ImGui::GetStyle().ScrollbarSize + 2.0f), true, ImGuiWindowFlags_HorizontalScrollbar);
+            {
+                ImDrawList* draw_list = ImGui::GetWindowDrawList();
+                const ImVec2 origin = ImGui::GetCursorScreenPos();
+                const float flame_width = (ImGui::GetContentRegionAvail().x) * profiler_zoom;
+                const double ns_to_px = (frame->EndNs > frame->StartNs) ? flame_width / (double)(frame->EndNs - frame->StartNs) : 0.0;
+                for (int n = 0; n < frame->Scopes.Size; n++)
+                {
+                    const ImGuiProfilerScope& scope = frame->Scopes[n];
+                    const ImU64 end_ns = scope.EndNs ? scope.EndNs : frame->EndNs;
+                    ImRect r(origin.x + (float)((scope.StartNs - frame->StartNs) * ns_to_px), origin.y + scope.Depth * row_height, 0.0f, 0.0f);
+                    r.Max = ImVec2(ImMax(r.Min.x + 1.0f, origin.x + (float)((end_ns - frame->StartNs) * ns_to_px)), r.Min.y + row_height - 1.0f);
+                    float hue = (ImHashStr(scope.Name) & 0xFF) / 255.0f, col_r, col_g, col_b;
+                    ImGui::ColorConvertHSVtoRGB(hue, 0.50f, 0.65f, col_r, col_g, col_b);
+                    draw_list->AddRectFilled(r.Min, r.Max, ImGui::GetColorU32(ImVec4(col_r, col_g, col_b, 1.0f)));
+                    if (r.GetWidth() > ImGui::GetFontSize())
+                        ImGui::RenderTextClipped(r.Min + ImVec2(2.0f, 1.0f), r.Max, scope.Name, NULL, NULL, ImVec2(0.0f, 0.0f), &r);
+                    if (ImGui::IsWindowHovered() && r.Contains(g.IO.MousePos))
+                        ImGui::SetTooltip("%s\n%.3f ms (%.1f%% of frame)", scope.Name, (end_ns - scope.StartNs) / 1000000.0, frame_ms > 0.0 ? (end_ns - scope.StartNs) / 10000.0 / frame_ms : 0.0);
+                }
+                ImGui::Dummy(ImVec2(flame_width, row_height * (max_depth + 1)));
+            }
+            ImGui::EndChild();
+
+            if (ImGui::TreeNode("Scopes", "Scopes (%d)", frame->Scopes.Size))
+            {
+                for (int n = 0; n < frame->Scopes.Size; n++)
+                {
+                    const ImGuiProfilerScope& scope = frame->Scopes[n];
+                    ImGui::Text("%*s%s: %.3f ms", scope.Depth * 2, "", scope.Name, scope.EndNs ? (scope.EndNs - scope.StartNs) / 1000000.0 : 0.0);
+                }
+                ImGui::TreePop();
+            }
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("AllocAudit", "Allocation audit (%d allocations after warm-up)", g.AllocAuditViolationsCount))
+    {
+        int mode = (int)g.AllocAuditMode;
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        if (ImGui::Combo("Mode", &mode, "None\0Record\0Assert\0"))
+            g.AllocAuditMode = (ImGuiAllocAuditMode)mode;
+        ImGui::SameLine();
+        if (ImGui::Button("Restart"))
+            ImGui::AllocAuditRestart();
+        if (g.AllocAuditStartFrame == -1)
+            ImGui::TextDisabled("Not auditing.");
+        else if (!g.AllocAuditActive)
+            ImGui::Text("Warming up: frame %d/%d", g.FrameCount - g.AllocAuditStartFrame, g.AllocAuditWarmupFrames);
+        ImGui::Text("Warm-up: %d allocations (%d KB), high-water mark %d active allocations", g.AllocAuditWarmupAllocsCount, (int)(g.AllocAuditWarmupAllocsBytes / 1024), g.AllocAuditHighWaterMark);
+        ImGui::Text("Pre-reserved headroom: %.0f%%", g.AllocReserveHeadroom * 100.0f);
+        const int records_count = ImMin(g.AllocAuditViolationsCount, IM_ARRAYSIZE(g.AllocAuditRecords));
+        for (int n = 0; n < records_count; n++)
+        {
+            const ImGuiAllocAuditRecord& record = g.AllocAuditRecords[(g.AllocAuditViolationsCount - 1 - n) % IM_ARRAYSIZE(g.AllocAuditRecords)];
+            ImGui::BulletText("Frame %d: %d bytes in %s, window '%s'", record.FrameCount, (int)record.Size, record.Tag ? record.Tag : "user code", record.WindowName ? record.WindowName : "NULL");
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::TreeNode("Memory", "Memory (%d active allocations)", io.MetricsActiveAllocations))
+    {
+        ImGui::Checkbox("Track allocations per subsystem", &g.MemoryTagsEnabled);
+        if (g.MemoryAllocs == NULL)
+        {
+            ImGui::TextDisabled("Not tracking.");
+        }
+        else
+        {
+            ImGui::Text("Tracked: %d allocations (%d made before tracking), hash table %d KB", g.MemoryAllocsCount, io.MetricsActiveAllocations - g.MemoryAllocsCount, g.MemoryAllocsCapacity * (int)sizeof(ImGuiMemoryAlloc) / 1024);
+            for (int tag = 0; tag < ImGuiMemoryTag_COUNT; tag++)
+            {
+                const ImGuiMemoryTagStats& stats = g.MemoryTagStats[tag];
+                ImGui::BulletText("%-10s %7d KB in %5d allocations, peak %7d KB", ImGui::MemoryTagGetName(tag), (int)(stats.LiveBytes / 1024), stats.LiveCount, (int)(stats.PeakBytes / 1024));
+            }
+
+            // Windows sorted by tracked memory, to find the ones growing in long sessions
+            if (ImGui::TreeNode("Windows", "Windows by tracked memory (%d)", g.Windows.Size))
+            {
+                ImGuiWindow** windows = (ImGuiWindow**)g.FrameArena.Alloc(sizeof(ImGuiWindow*) * (size_t)g.Windows.Size);
+                memcpy(windows, g.Windows.Data, sizeof(ImGuiWindow*) * (size_t)g.Windows.Size);
+                ImQsort(windows, (size_t)g.Windows.Size, sizeof(ImGuiWindow*), Funcs::MemoryTagsBytesComparer);
+                for (int n = 0; n < g.Windows.Size; n++)
+                    Funcs::NodeMemoryTagsBytes(windows[n]);
+                ImGui::TreePop();
+            }
+        }
+        ImGui::TreePop();
+    }
+
     if (ImGui::TreeNode("Internal state"))
     {
         const char* input_source_names[] = { "None", "Mouse", "Nav", "NavKeyboard", "NavGamepad" }; IM_ASSERT(IM_ARRAYSIZE(input_source_names) == ImGuiInputSource_COUNT);
@@ -9992,6 +11839,16 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGui::Text("NavActivateId: 0x%08X, NavInputId: 0x%08X", g.NavActivateId, g.NavInputId);
         ImGui::Text("NavDisableHighlight: %d, NavDisableMouseHover: %d", g.NavDisableHighlight, g.NavDisableMouseHover);
         ImGui::Text("NavWindowingTarget: '%s'", g.NavWindowingTarget ? g.NavWindowingTarget->Name : "NULL");
+        ImGui::Text("NextFrameTimeout: %.3f, FramesSinceLastInput: %d", g.IO.NextFrameTimeout, g.FramesSinceLastInput);
+        ImGui::Text("Deferred tessellation: %d primitives in %d jobs%s", g.TessellatePrimsCount, g.TessellateJobs.Size, g.IO.ParallelForFn ? " (parallel)" : "");
+        ImGui::Text("Flattened draw data: %d draw lists, %d vertex offsets", g.FlattenedListsCount, g.FlattenedSegmentsCount);
+        ImGui::Text("Frame arena: %d bytes in %d allocations last frame (%d overflowed), peak %d bytes, block %d bytes", g.FrameArena.LastUsedBytes, g.FrameArena.LastAllocsCount, g.FrameArena.LastOverflowCount, g.FrameArena.PeakUsedBytes, g.FrameArena.BlockSize);
+        if (g.IO.ConfigMergeDrawCmds)
+            ImGui::Text("Merged draw commands: %d before, %d after", g.MergeDrawCmdsBeforeCount, g.MergeDrawCmdsAfterCount);
+        if (g.IO.ConfigOcclusionCulling)
+            ImGui::Text("Occlusion culling: %d occluders, %d draw lists culled (%d vertices)", g.Occluders.Size, g.OcclusionCulledRects.Size, g.OcclusionCulledVtxCount);
+        if (g.IO.Fonts->DynamicData)
+            ImGui::Text("Dynamic glyphs: %d rasterized, %d evicted, %d overflowed", g.IO.Fonts->DynamicGlyphsRasterizedCount, g.IO.Fonts->DynamicGlyphsEvictedCount, g.IO.Fonts->DynamicGlyphsOverflowCount);
         ImGui::Text("DragDrop: %d, SourceId = 0x%08X, Payload \"%s\" (%d bytes)", g.DragDropActive, g.DragDropPayload.SourceId, g.DragDropPayload.DataType, g.DragDropPayload.DataSize);
         ImGui::TreePop();
     }
@@ -10009,9 +11866,24 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGui::BulletText("'%s': (%.1f,%.1f) (%.1f,%.1f) Size (%.1f,%.1f)", g.NavWindow->Name, r.Min.x, r.Min.y, r.Max.x, r.Max.y, r.GetWidth(), r.GetHeight());
         }
         ImGui::Checkbox("Show clipping rectangle when hovering ImDrawCmd node", &show_drawcmd_clip_rects);
+        ImGui::Checkbox("Show occluders and culled draw lists", &show_occlusion_culling);
+        ImGui::SameLine(); ImGui::TextDisabled("(io.ConfigOcclusionCulling: %s)", g.IO.ConfigOcclusionCulling ? "on" : "off");
         ImGui::TreePop();
     }
 
+    // Occluders (green) and bounding boxes of culled draw lists (red), as of the last Render()
+    if (show_occlusion_culling)
+    {
+        ImDrawList* draw_list = GetForegroundDrawList();
+        for (int n = 0; n < g.Occluders.Size; n++)
+            draw_list->AddRect(g.Occluders[n].Min, g.Occluders[n].Max, IM_COL32(0, 255, 0, 255));
+        for (int n = 0; n < g.OcclusionCulledRects.Size; n++)
+        {
+            draw_list->AddRectFilled(g.OcclusionCulledRects[n].Min, g.OcclusionCulledRects[n].Max, IM_COL32(255, 0, 0, 48));
+            draw_list->AddRect(g.OcclusionCulledRects[n].Min, g.OcclusionCulledRects[n].Max, IM_COL32(255, 0, 0, 255));
+        }
+    }
+
     if (show_windows_rects || show_windows_begin_order)
     {
         for (int n = 0; n < g.Windows.Size; n++)
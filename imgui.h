@@ -93,13 +93,16 @@ Index of this file:
 
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
+struct ImDrawDeferredPrim;          // A line or filled shape recorded by ImDrawList with ImDrawListFlags_DeferTessellation, tessellated later by ImDrawList::TessellateDeferred()
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
+struct ImDrawListRetainedData;      // Lines, filled shapes and text tessellated during the previous frame, reused by ImDrawList with ImDrawListFlags_RetainTessellation
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasDynamicData;      // Runtime data for glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs), opaque
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
@@ -637,9 +640,14 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          RequestNextFrame(float delay = 0.0f);                               // request a new frame within 'delay' seconds even if no input event occurs, e.g. for time-based animations. Lowers io.NextFrameTimeout.
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
+    IMGUI_API ImDrawListSharedData* CreateDrawListSharedData();                                 // copy of GetDrawListSharedData() to build your own ImDrawList instances on other threads. The copy is never modified by dear imgui. Destroy with DestroyDrawListSharedData().
+    IMGUI_API void          DestroyDrawListSharedData(ImDrawListSharedData* shared_data);
+    IMGUI_API void          AddDrawListToWindow(ImDrawList* draw_list);                         // render 'draw_list' over the current window contents (under child windows) without copying it. When the frame is rendered, its clip rectangles are clipped to the current one and NULL texture ids set to the current one. Keep it alive and unmodified until then. A draw list can be attached once per frame, and its commands need to be rebuilt before attaching it again.
+    IMGUI_API void          AddDrawListToForeground(ImDrawList* draw_list);                     // same as AddDrawListToWindow(), rendered after the foreground draw list. To copy a draw list at a given position instead, use ImDrawList::AddDrawList().
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
@@ -688,6 +696,10 @@ namespace ImGui
     IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
+    // - Binary settings are a compact, versioned alternative to the .ini text format, which can be loaded without any text parsing.
+    //   LoadIniSettingsFromMemory()/LoadIniSettingsFromDisk() automatically detect binary data, so you can save with SaveBinarySettingsToMemory() and load with either.
+    IMGUI_API bool          LoadBinarySettingsFromMemory(const void* data, size_t data_size);   // call after CreateContext() and before the first call to NewFrame(). return false (and load nothing) if the data is not valid binary settings of the current version.
+    IMGUI_API const void*   SaveBinarySettingsToMemory(size_t* out_size);                       // return binary settings data which you can save by your own mean. call when io.WantSaveIniSettings is set, same as SaveIniSettingsToMemory().
 
     // Memory Allocators
     // - All those functions are not reliant on the current context.
@@ -726,6 +738,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 18,  // No gamepad/keyboard navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 19,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 20,  // Append '*' to title without affecting the ID, as a convenience to avoid using the ### operator. When used in a tab/docking context, tab is selected on closure and closure is deferred by one frame to allow code to cancel the closure (with a confirmation popup, etc.) without flicker.
+    ImGuiWindowFlags_RetainDrawList         = 1 << 21,  // Reuse the tessellation of lines, filled shapes and text from the previous frame when they are submitted again with the same parameters at the same position in the draw list. Reuse rates are displayed in the Metrics window.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1360,6 +1373,11 @@ struct ImGuiIO
     bool        ConfigInputTextCursorBlink;     // = true           // Set to false to disable blinking cursor, for users who consider it distracting. (was called: io.OptCursorBlink prior to 1.63)
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
+    bool        ConfigDeferTessellation;        // = false          // [BETA] Lines and filled shapes are recorded during the frame and tessellated by Render() (in parallel if io.ParallelForFn is set). Output is identical.
+    bool        ConfigFlattenDrawData;          // = false          // Render() concatenates all draw lists into a single one (in parallel if io.ParallelForFn is set), so the back-end uploads a single vertex/index buffer. Skipped when it would need ImDrawCmd::VtxOffset without ImGuiBackendFlags_RendererHasVtxOffset.
+    bool        ConfigMergeDrawCmds;            // = false          // Render() merges adjacent draw commands which can be issued as a single draw call (see ImDrawData::MergeDrawCmds()). Merges across windows require io.ConfigFlattenDrawData.
+    bool        ConfigOcclusionCulling;         // = false          // Render() skips draw lists which are entirely hidden behind the opaque background of windows in front of them. Conservative: draw lists with callbacks are never skipped. See Metrics > Tools to visualize.
+    float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Free the transient buffers of windows unused for this amount of time (in seconds), e.g. popups and tooltips. They are restored when the window is used again. Set to -1.0f to disable.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1384,6 +1402,11 @@ struct ImGuiIO
     void        (*ImeSetInputScreenPosFn)(int x, int y);
     void*       ImeWindowHandle;                // = NULL           // (Windows) Set this to your HWND to get automatic IME cursor positioning.
 
+    // Optional: Run jobs in parallel (e.g. tessellation with io.ConfigDeferTessellation, flattening with io.ConfigFlattenDrawData). Default to NULL: jobs are run sequentially by the calling thread.
+    // Call 'func(data, n)' for every n in [0, count) from any number of threads, and return once they have all completed.
+    void        (*ParallelForFn)(void* user_data, void (*func)(void* data, int n), void* data, int count);
+    void*       ParallelForUserData;
+
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     // [OBSOLETE since 1.60+] Rendering function, will be automatically called in Render(). Please call your rendering function yourself now!
     // You can obtain the ImDrawData* by calling ImGui::GetDrawData() after Render(). See example applications if you are unsure of how to implement this.
@@ -1431,6 +1454,7 @@ struct ImGuiIO
     int         MetricsActiveWindows;           // Number of active windows
     int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
+    float       NextFrameTimeout;               // Updated by EndFrame(): delay in seconds after which a new frame is needed even if no input event occurs (0.0f: as soon as possible, FLT_MAX: only on the next input event). Use it to idle your main loop, e.g. glfwWaitEventsTimeout(io.NextFrameTimeout).
 
     //------------------------------------------------------------------
     // [Internal] ImGui will maintain those fields. Forward compatibility not guaranteed!
@@ -1663,11 +1687,22 @@ struct ImGuiStorage
         Pair(ImGuiID _key, void* _val_p) { key = _key; val_p = _val_p; }
     };
     ImVector<Pair>      Data;
+    ImVector<int>       HashIndex;  // [Hashed mode] Open-addressing table of indices into Data[], -1 for empty slots. Size is a power of two.
+    bool                Hashed;     // Use hashed mode (see SetHashed())
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    // - Hashed mode (opt-in, or default with IMGUI_USE_HASHED_STORAGE): Data[] is unsorted and indexed by HashIndex[], queries and insertions are O(1).
+    //   It is still fine to iterate Data[] in both modes. If you add to Data[] directly, call BuildSortByKey() afterward to rebuild the index.
+#ifdef IMGUI_USE_HASHED_STORAGE
+    ImGuiStorage()      { Hashed = true; }
+#else
+    ImGuiStorage()      { Hashed = false; }
+#endif
+    void                Clear() { Data.clear(); HashIndex.clear(); }
+    IMGUI_API void      SetHashed(bool hashed);
+    IMGUI_API void      Remove(ImGuiID key);    // In hashed mode: O(1), the last pair of Data[] is moved into the hole
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -1690,6 +1725,7 @@ struct ImGuiStorage
     IMGUI_API void      SetAllInt(int val);
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // In hashed mode this rebuilds the hash index instead.
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -1806,7 +1842,33 @@ typedef unsigned short ImDrawIdx;
 #endif
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+// Compact vertex layout (12 bytes instead of 20), enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h. Your renderer back-end needs to support it.
+// Positions are stored as 16-bit fixed-point values in 1/IM_DRAWVERT_POS_SCALE pixel units (range -8192..+8191.75), texture coordinates as 16-bit normalized values.
+// They are converted from/to ImVec2 when assigned/read, e.g. 'ImVec2 pos = vtx.pos;'. Components can't be accessed individually.
+// Values are rounded to the nearest step and clamped in the integer domain, which is much faster than clamping floats (positions are expected within +/-2^28).
+#define IM_DRAWVERT_POS_SCALE       4.0f
+struct ImDrawVertPos16
+{
+    ImS16   X, Y;
+    ImDrawVertPos16& operator=(const ImVec2& v) { X = Pack(v.x); Y = Pack(v.y); return *this; }
+    operator ImVec2() const                     { return ImVec2(X * (1.0f / IM_DRAWVERT_POS_SCALE), Y * (1.0f / IM_DRAWVERT_POS_SCALE)); }
+    static ImS16 Pack(float v)                  { int i = (int)(v * IM_DRAWVERT_POS_SCALE + 32768.5f); i = (i < 0) ? 0 : (i > 65535) ? 65535 : i; return (ImS16)(i - 32768); }
+};
+struct ImDrawVertUV16
+{
+    ImU16   U, V;
+    ImDrawVertUV16& operator=(const ImVec2& v)  { U = Pack(v.x); V = Pack(v.y); return *this; }
+    operator ImVec2() const                     { return ImVec2(U * (1.0f / 65535.0f), V * (1.0f / 65535.0f)); }
+    static ImU16 Pack(float v)                  { int i = (int)(v * 65535.0f + 0.5f); return (ImU16)((i < 0) ? 0 : (i > 65535) ? 65535 : i); }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos16 pos;
+    ImDrawVertUV16  uv;
+    ImU32           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -1821,6 +1883,20 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// [Internal] Line or filled shape recorded by AddPolyline()/AddConvexPolyFilled() with ImDrawListFlags_DeferTessellation.
+// Its indices are already written, vertices are written by ImDrawList::TessellateDeferred().
+struct ImDrawDeferredPrim
+{
+    int             VtxOffset;          // Reserved vertices in VtxBuffer
+    int             PointsOffset;       // Points in ImDrawList::_DeferredPoints
+    int             PointsCount;
+    ImU32           Col;
+    float           Thickness;          // AddPolyline() only
+    bool            Filled;             // AddConvexPolyFilled()
+    bool            Closed;             // AddPolyline() only
+    bool            AntiAliased;
+};
+
 // For use by ImDrawListSplitter.
 struct ImDrawChannel
 {
@@ -1862,7 +1938,10 @@ enum ImDrawListFlags_
     ImDrawListFlags_None             = 0,
     ImDrawListFlags_AntiAliasedLines = 1 << 0,  // Lines are anti-aliased (*2 the number of triangles for 1.0f wide line, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedFill  = 1 << 1,  // Filled shapes have anti-aliased edges (*2 the number of vertices)
-    ImDrawListFlags_AllowVtxOffset   = 1 << 2   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset   = 1 << 2,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_RetainTessellation = 1 << 3, // Reuse the vertices and indices of lines, filled shapes and text left in the buffers by the previous frame (see _Retained). Set for windows using ImGuiWindowFlags_RetainDrawList.
+    ImDrawListFlags_DeferTessellation = 1 << 4, // Reserve and index lines and filled shapes, but only write their vertices in TessellateDeferred(). Set when 'io.ConfigDeferTessellation' is enabled.
+    ImDrawListFlags_NoRasterizeGlyphs = 1 << 5  // Text never modifies a font atlas using ImFontAtlasFlags_DynamicGlyphs: glyphs rasterized on demand are rendered with the fallback glyph. Set by ImGui::CreateDrawListSharedData().
 };
 
 // Draw command list
@@ -1892,8 +1971,14 @@ struct ImDrawList
     ImVector<ImTextureID>   _TextureIdStack;    // [Internal]
     ImVector<ImVec2>        _Path;              // [Internal] current path building
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api
+    ImDrawListRetainedData* _Retained;          // [Internal] primitives of the previous frame (when 'Flags & ImDrawListFlags_RetainTessellation')
+    ImVector<ImDrawDeferredPrim> _DeferredPrims; // [Internal] primitives waiting for TessellateDeferred() (when 'Flags & ImDrawListFlags_DeferTessellation')
+    ImVector<ImVec2>        _DeferredPoints;    // [Internal] points of _DeferredPrims
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
+    // ImDrawList instances may be built on other threads, as long as their shared data isn't modified meanwhile (use ImGui::CreateDrawListSharedData()) and a font is passed to AddText().
+    // With ImFontAtlasFlags_DynamicGlyphs, AddText() on other threads is only safe with ImDrawListFlags_NoRasterizeGlyphs (set by ImGui::CreateDrawListSharedData()), otherwise it modifies the atlas.
+    // Note that ImGui::MemAlloc()/MemFree() update io.MetricsActiveAllocations without synchronization, so that statistic may be off while lists grow on other threads.
     ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; _OwnerName = NULL; Clear(); }
     ~ImDrawList() { ClearFreeMemory(); }
     IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
@@ -1942,6 +2027,9 @@ struct ImDrawList
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API void  TessellateDeferred();                                       // Write vertices of primitives recorded with ImDrawListFlags_DeferTessellation. Called by ImGui::Render() for the draw lists it renders.
+    IMGUI_API void  AddDrawList(const ImDrawList* src, const ImVec2& offset = ImVec2(0,0)); // Append a copy of 'src' translated by 'offset'. Its clip rectangles are translated and clipped to the current one, NULL texture ids set to the current one.
+    IMGUI_API void  ReserveBuffers(int idx_count, int vtx_count);              // Pre-reservation hint: grow the capacity of IdxBuffer/VtxBuffer so that up to 'idx_count'/'vtx_count' elements can be added without allocating. Contents are unchanged.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit foreground primitives before background primitives)
@@ -1963,6 +2051,7 @@ struct ImDrawList
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)     { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); }
     IMGUI_API void  UpdateClipRect();
     IMGUI_API void  UpdateTextureID();
+    IMGUI_API void  TessellateDeferredRange(int prim_begin, int prim_end);     // Write vertices of _DeferredPrims[prim_begin..prim_end). Different ranges of a same list may be processed concurrently.
 };
 
 // All draw data to render an ImGui frame
@@ -1985,6 +2074,8 @@ struct ImDrawData
     void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API int   FlattenInto(ImDrawList* out_list, bool rebase_indices = true) const; // Helper to concatenate all draw lists into 'out_list', to upload a single vertex/index buffer. Returns the number of distinct ImDrawCmd::VtxOffset values: if > 1 your renderer needs to honor VtxOffset. See io.ConfigFlattenDrawData.
+    IMGUI_API int   MergeDrawCmds();                        // Helper to merge adjacent commands of each draw list which can be issued as a single draw call, and remove empty ones. Returns the number of removed commands. See io.ConfigMergeDrawCmds.
 };
 
 //-----------------------------------------------------------------------------
@@ -2045,7 +2136,8 @@ enum ImFontAtlasFlags_
 {
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1    // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 2    // Only rasterize ASCII + fallback glyphs in Build(), other glyphs are rasterized on first use into a cache area of TexDynamicCacheHeight pixels, evicting least recently used glyphs. Backends need to upload the TexDirtyRects regions (see IsTexDirty()). Glyph lookups modify the atlas: text drawn on other threads must use ImDrawListFlags_NoRasterizeGlyphs. Not supported by misc/freetype.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2091,6 +2183,16 @@ struct ImFontAtlas
     bool                        IsBuilt()                   { return Fonts.Size > 0 && (TexPixelsAlpha8 != NULL || TexPixelsRGBA32 != NULL); }
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // With ImFontAtlasFlags_DynamicGlyphs, glyphs are rasterized during the frame and the pixels of the TexDirtyRects rectangles are modified (at most one per page of glyphs).
+    // Backends need to upload those regions (e.g. glTexSubImage2D with GL_UNPACK_ROW_LENGTH = TexWidth) before rendering the frame, then call ClearTexDirty().
+    // Don't call ClearTexData() after uploading the texture: on-demand rasterization needs the CPU-side pixels.
+    struct TexDirtyRect
+    {
+        int             X0, Y0, X1, Y1; // Modified pixels, X1/Y1 excluded
+    };
+    bool                        IsTexDirty() const          { return TexDirtyRects.Size > 0; }
+    void                        ClearTexDirty()             { TexDirtyRects.resize(0); }
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2144,6 +2246,17 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    int                         TexDynamicCacheHeight; // = 1024 // Height in pixels of the texture area reserved for glyphs rasterized on demand, when using ImFontAtlasFlags_DynamicGlyphs.
+    ImVector<TexDirtyRect>      TexDirtyRects;      // Texture regions modified since last ClearTexDirty() (ImFontAtlasFlags_DynamicGlyphs)
+
+    // Optional: Rasterize glyphs in parallel in Build(), same contract as io.ParallelForFn. When NULL, io.ParallelForFn of the current context is used (if any). Output is identical.
+    // stb_truetype allocations made by worker threads call the allocator functions directly (see ImGui::SetAllocatorFunctions()), which then need to be thread-safe.
+    void                        (*ParallelForFn)(void* user_data, void (*func)(void* data, int n), void* data, int count);
+    void*                       ParallelForUserData;
+
+    // Optional: Path to a cache of the built atlas. Build() loads it instead of rasterizing when it was saved from the same fonts data, configurations, ranges
+    // and custom rectangles, otherwise builds the atlas then (over)writes the file. Not used with ImFontAtlasFlags_DynamicGlyphs or misc/freetype.
+    const char*                 CacheFilename;      // = NULL
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2157,6 +2270,11 @@ struct ImFontAtlas
     ImVector<CustomRect>        CustomRects;        // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Internal data
     int                         CustomRectIds[1];   // Identifiers of custom texture rectangle used by ImFontAtlas/ImDrawList
+    ImFontAtlasDynamicData*     DynamicData;        // Glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+    int                         DynamicFrameCount;  // Incremented by ImGui::NewFrame(). Glyphs used during the current frame are never evicted.
+    int                         DynamicGlyphsRasterizedCount;   // Statistics: glyphs rasterized on demand
+    int                         DynamicGlyphsEvictedCount;      // Statistics: glyphs evicted to make room for another one
+    int                         DynamicGlyphsOverflowCount;     // Statistics: glyphs left blank because the cache area is full of glyphs used during the current frame
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontGlyphRangesBuilder GlyphRangesBuilder; // OBSOLETE 1.67+
@@ -2167,13 +2285,14 @@ struct ImFontAtlas
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
 struct ImFont
 {
-    // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    // Members: Hot ~32/40 bytes (for CalcTextSize)
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI). Paged, see GetIndexOffset().
+    ImVector<ImU16>             IndexPages;         // 12-16 // out //            // Page of IndexAdvanceX[]/IndexLookup[] holding each block of 256 code-points, up to the last block with a glyph.
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
 
     // Members: Hot ~36/48 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Index glyphs by Unicode code-point. Paged, see GetIndexOffset().
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
     ImVec2                      DisplayOffset;      // 8     // in  // = (0,0)    // Offset font rendering by xx pixels
@@ -2187,13 +2306,15 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     bool                        DirtyLookupTables;  // 1     // out //
+    int                         DynamicIndex;       // 4     // out // = -1     // Index in ContainerAtlas->Fonts[] when some glyphs are rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    IMGUI_API const ImFontGlyph*FindGlyphNoRasterize(ImWchar c) const;
+    float                       GetCharAdvance(ImWchar c) const     { const int offset = GetIndexOffset(c); return (offset >= 0) ? IndexAdvanceX.Data[offset] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
@@ -2209,6 +2330,9 @@ struct ImFont
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
     IMGUI_API void              GrowIndex(int new_size);
+    // IndexAdvanceX[] and IndexLookup[] are made of pages of 256 code-points: page 0 always holds 0x00..0xFF (ASCII + Latin-1), page 1 is an empty page (fallback advance, no glyph)
+    // shared by every block of 256 code-points without glyphs, followed by the pages of the other blocks in code-point order. Returns -1 past the last block with glyphs (or before building).
+    int                         GetIndexOffset(unsigned int c) const { return ((c >> 8) < (unsigned int)IndexPages.Size) ? (IndexPages.Data[c >> 8] << 8) + (int)(c & 0xFF) : -1; }
     IMGUI_API void              AddGlyph(ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetFallbackChar(ImWchar c);
@@ -337,6 +337,14 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigWindowsResizeFromEdges", &io.ConfigWindowsResizeFromEdges);
             ImGui::SameLine(); HelpMarker("Enable resizing of windows from their edges and from the lower-left corner.\nThis requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback.");
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
+            ImGui::Checkbox("io.ConfigDeferTessellation", &io.ConfigDeferTessellation);
+            ImGui::SameLine(); HelpMarker("Record lines and filled shapes during the frame and tessellate them in Render(), in parallel if io.ParallelForFn is set by the application.");
+            ImGui::Checkbox("io.ConfigFlattenDrawData", &io.ConfigFlattenDrawData);
+            ImGui::SameLine(); HelpMarker("Concatenate all draw lists in Render(), so the renderer back-end uploads a single vertex/index buffer per frame.");
+            ImGui::Checkbox("io.ConfigMergeDrawCmds", &io.ConfigMergeDrawCmds);
+            ImGui::SameLine(); HelpMarker("Merge adjacent draw commands in Render() when they can be issued as a single draw call. Combine with io.ConfigFlattenDrawData to merge commands of different windows.");
+            ImGui::Checkbox("io.ConfigOcclusionCulling", &io.ConfigOcclusionCulling);
+            ImGui::SameLine(); HelpMarker("Skip rendering windows (or parts of windows) hidden behind the opaque background of windows in front of them.\nUse Metrics > Tools to visualize what is culled.");
             ImGui::Checkbox("io.MouseDrawCursor", &io.MouseDrawCursor);
             ImGui::SameLine(); HelpMarker("Instruct Dear ImGui to render a mouse cursor for you. Note that a mouse cursor rendered via your application GPU rendering path will feel more laggy than hardware cursor, but will be more in sync with your other visuals.\n\nSome desktop applications may use both kinds of cursors (e.g. enable software cursor only when resizing/dragging something).");
             ImGui::TreePop();
@@ -1030,6 +1038,8 @@ static void ShowDemoWindowWidgets()
     {
         static bool animate = true;
         ImGui::Checkbox("Animate", &animate);
+        if (animate)
+            ImGui::RequestNextFrame(); // Keep refreshing when the application is idling (see io.NextFrameTimeout)
 
         static float arr[] = { 0.6f, 0.1f, 1.0f, 0.5f, 0.92f, 0.1f, 0.2f };
         ImGui::PlotLines("Frame Times", arr, IM_ARRAYSIZE(arr));
@@ -2861,6 +2871,10 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigInputTextCursorBlink)                              ImGui::Text("io.ConfigInputTextCursorBlink");
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
+        if (io.ConfigDeferTessellation)                                 ImGui::Text("io.ConfigDeferTessellation");
+        if (io.ConfigFlattenDrawData)                                   ImGui::Text("io.ConfigFlattenDrawData");
+        if (io.ConfigMergeDrawCmds)                                     ImGui::Text("io.ConfigMergeDrawCmds");
+        if (io.ConfigOcclusionCulling)                                  ImGui::Text("io.ConfigOcclusionCulling");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
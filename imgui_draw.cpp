@@ -132,8 +132,8 @@ namespace IMGUI_STB_NAMESPACE
 
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#define STBTT_malloc(x,u)   ((u) ? ImGui::MemAllocUntracked(x) : IM_ALLOC(x))   // Non-NULL userdata: called from a worker thread (see ImFontAtlasBuildRasterJobFunc)
+#define STBTT_free(x,u)     ((u) ? ImGui::MemFreeUntracked(x) : IM_FREE(x))
 #define STBTT_assert(x)     IM_ASSERT(x)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -374,6 +374,9 @@ void ImDrawList::Clear()
     _TextureIdStack.resize(0);
     _Path.resize(0);
     _Splitter.Clear();
+    _Retained = NULL;
+    _DeferredPrims.resize(0);
+    _DeferredPoints.resize(0);
 }
 
 void ImDrawList::ClearFreeMemory()
@@ -388,10 +391,13 @@ void ImDrawList::ClearFreeMemory()
     _TextureIdStack.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _DeferredPrims.clear();
+    _DeferredPoints.clear();
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
 {
+    IM_ASSERT(_DeferredPrims.Size == 0 && "Call TessellateDeferred() first!");
     ImDrawList* dst = IM_NEW(ImDrawList(NULL));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
@@ -430,6 +436,65 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
+// Append a copy of 'src', e.g. a list built on another thread (see ImGui::CreateDrawListSharedData()).
+// Vertices are copied in one go and indices rebased on the first copied vertex, so the whole 'src' must fit in the current 16-bit index range.
+void ImDrawList::AddDrawList(const ImDrawList* src, const ImVec2& offset)
+{
+    IM_ASSERT(src != this);
+    IM_ASSERT(src->_DeferredPrims.Size == 0 && "Call TessellateDeferred() on the source draw list first!");
+    if (src->VtxBuffer.Size == 0)
+        return;
+
+    const int vtx_count = src->VtxBuffer.Size;
+    PrimReserve(0, vtx_count);
+    IM_ASSERT((sizeof(ImDrawIdx) == 4 || _VtxCurrentIdx + vtx_count < (1 << 16)) && "Too many vertices in ImDrawList using 16-bit indices.");
+    const unsigned int vtx_base = _VtxCurrentIdx;
+    if (offset.x == 0.0f && offset.y == 0.0f)
+    {
+        memcpy(_VtxWritePtr, src->VtxBuffer.Data, (size_t)src->VtxBuffer.size_in_bytes());
+    }
+    else
+    {
+        for (int n = 0; n < vtx_count; n++)
+        {
+            _VtxWritePtr[n] = src->VtxBuffer.Data[n];
+            _VtxWritePtr[n].pos = ImVec2(src->VtxBuffer.Data[n].pos) + offset;
+        }
+    }
+    _VtxWritePtr += vtx_count;
+    _VtxCurrentIdx += vtx_count;
+
+    // Commands are translated and clipped to our current clip rectangle (fully clipped ones are dropped), commands without texture use our current one.
+    const ImVec4 clip_rect = GetCurrentClipRect();
+    const ImTextureID texture_id = GetCurrentTextureId();
+    unsigned int idx_offset = 0;
+    for (const ImDrawCmd* src_cmd = src->CmdBuffer.begin(); src_cmd < src->CmdBuffer.end(); idx_offset += src_cmd->ElemCount, src_cmd++)
+    {
+        if (src_cmd->UserCallback != NULL)
+        {
+            AddCallback(src_cmd->UserCallback, src_cmd->UserCallbackData);
+            continue;
+        }
+        const ImVec4 cmd_clip_rect(ImMax(src_cmd->ClipRect.x + offset.x, clip_rect.x), ImMax(src_cmd->ClipRect.y + offset.y, clip_rect.y), ImMin(src_cmd->ClipRect.z + offset.x, clip_rect.z), ImMin(src_cmd->ClipRect.w + offset.y, clip_rect.w));
+        if (src_cmd->ElemCount == 0 || cmd_clip_rect.x >= cmd_clip_rect.z || cmd_clip_rect.y >= cmd_clip_rect.w)
+            continue;
+        _ClipRectStack.push_back(cmd_clip_rect);
+        _TextureIdStack.push_back(src_cmd->TextureId != (ImTextureID)NULL ? src_cmd->TextureId : texture_id);
+        UpdateClipRect();
+        UpdateTextureID();
+        PrimReserve((int)src_cmd->ElemCount, 0);
+        const ImDrawIdx* src_idx = src->IdxBuffer.Data + idx_offset;
+        const unsigned int idx_base = vtx_base + src_cmd->VtxOffset;
+        for (unsigned int n = 0; n < src_cmd->ElemCount; n++)
+            _IdxWritePtr[n] = (ImDrawIdx)(src_idx[n] + idx_base);
+        _IdxWritePtr += src_cmd->ElemCount;
+        _ClipRectStack.pop_back();
+        _TextureIdStack.pop_back();
+    }
+    UpdateClipRect();
+    UpdateTextureID();
+}
+
 // Our scheme may appears a bit unusual, basically we want the most-common calls AddLine AddRect etc. to not have to perform any check so we always have a command ready in the stack.
 // The cost of figuring out if a new command has to be added or if we can merge is paid in those Update** functions only.
 void ImDrawList::UpdateClipRect()
@@ -473,6 +538,111 @@ void ImDrawList::UpdateTextureID()
 #undef GetCurrentClipRect
 #undef GetCurrentTextureId
 
+// Draw lists using ImDrawListFlags_RetainTessellation (see ImGuiWindowFlags_RetainDrawList, ImDrawListRetainedData)
+// Lines, filled shapes and text are hashed from their parameters before being tessellated. When the previous frame tessellated a primitive with
+// the same hash at the same position in the buffers, its output is still there and we only advance the buffers. Everything else is appended to
+// the buffers as usual, so nothing written during the frame overwrites an output we may reuse later in the frame.
+// The hash is the only change detector, so this uses a 64-bit multiply-rotate hash over 8 bytes words instead of ImHashData() (CRC32, one byte
+// at a time), which is several times slower and too collision-prone. Large blocks (e.g. long text) are hashed over 4 independent lanes.
+static inline ImU64 ImRetainHashRound(ImU64 h, ImU64 k)
+{
+    k *= 0x87C37B91114253D5ULL;
+    k = (k << 31) | (k >> 33);
+    h ^= k * 0x4CF5AD432745937FULL;
+    return ((h << 27) | (h >> 37)) * 5 + 0x52DCE729;
+}
+
+static ImU64 ImRetainHash(const void* data_p, size_t data_size, ImU64 h)
+{
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 k[4];
+    if (data_size >= sizeof(k) * 2)
+    {
+        ImU64 h1 = ~h, h2 = h ^ 0x9E3779B97F4A7C15ULL, h3 = h + 0x3C6EF372FE94F82BULL;
+        for (; data_size >= sizeof(k); data += sizeof(k), data_size -= sizeof(k))
+        {
+            memcpy(k, data, sizeof(k));
+            h = ImRetainHashRound(h, k[0]);
+            h1 = ImRetainHashRound(h1, k[1]);
+            h2 = ImRetainHashRound(h2, k[2]);
+            h3 = ImRetainHashRound(h3, k[3]);
+        }
+        h = ImRetainHashRound(ImRetainHashRound(ImRetainHashRound(h, h1), h2), h3);
+    }
+    for (; data_size >= sizeof(ImU64); data += sizeof(ImU64), data_size -= sizeof(ImU64))
+    {
+        memcpy(k, data, sizeof(ImU64));
+        h = ImRetainHashRound(h, k[0]);
+    }
+    k[0] = 0;
+    memcpy(k, data, data_size);
+    return ImRetainHashRound(h, k[0] ^ ((ImU64)data_size << 56));
+}
+
+// Return true if the output of the previous frame was reused. Otherwise the caller tessellates the primitive then calls ImDrawListRetainEnd().
+static bool ImDrawListRetainBegin(ImDrawList* draw_list, const void* params, size_t params_size, const void* data, size_t data_size, ImDrawRetainedPrim* prim)
+{
+    ImDrawListRetainedData* retained = draw_list->_Retained;
+    prim->Hash = ImRetainHash(data, data_size, ImRetainHash(params, params_size, 0));
+    prim->VtxOffset = draw_list->VtxBuffer.Size;
+    prim->IdxOffset = draw_list->IdxBuffer.Size;
+    prim->VtxCurrentIdx = draw_list->_VtxCurrentIdx;
+
+    // Indices of other channels are written in their own buffers, and the buffers holding the previous output must not have been reallocated
+    if (draw_list->_Splitter._Current != 0 || draw_list->CmdBuffer.Size == 0)
+        return false;
+    if (draw_list->VtxBuffer.Data != retained->VtxData || draw_list->VtxBuffer.Capacity != retained->VtxCapacity || draw_list->IdxBuffer.Data != retained->IdxData || draw_list->IdxBuffer.Capacity != retained->IdxCapacity)
+        return false;
+
+    // Several primitives may share an offset when some of them output nothing (e.g. clipped text)
+    for (int prev_n = retained->PrevPrimsIdx; prev_n < retained->PrevPrims.Size; prev_n++)
+    {
+        const ImDrawRetainedPrim& prev = retained->PrevPrims.Data[prev_n];
+        if (prev.VtxOffset < prim->VtxOffset)
+        {
+            retained->PrevPrimsIdx = prev_n + 1;
+            continue;
+        }
+        if (prev.VtxOffset > prim->VtxOffset)
+            break;
+        if (prev.Hash != prim->Hash || prev.IdxOffset != prim->IdxOffset || prev.VtxCurrentIdx != prim->VtxCurrentIdx)
+            continue;
+
+        IM_ASSERT(prev.VtxOffset + prev.VtxCount <= draw_list->VtxBuffer.Capacity && prev.IdxOffset + prev.IdxCount <= draw_list->IdxBuffer.Capacity);
+        draw_list->VtxBuffer.Size += prev.VtxCount;
+        draw_list->IdxBuffer.Size += prev.IdxCount;
+        draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1].ElemCount += prev.IdxCount;
+        draw_list->_VtxCurrentIdx += prev.VtxCount;
+        draw_list->_VtxWritePtr = draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size;
+        draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+        retained->PrevPrimsIdx = prev_n + 1;
+        retained->Prims.push_back(prev);
+        retained->ReusedCount++;
+        return true;
+    }
+    return false;
+}
+
+static void ImDrawListRetainEnd(ImDrawList* draw_list, ImDrawRetainedPrim* prim)
+{
+    ImDrawListRetainedData* retained = draw_list->_Retained;
+    retained->TessellatedCount++;
+    prim->VtxCount = draw_list->VtxBuffer.Size - prim->VtxOffset;
+    prim->IdxCount = draw_list->IdxBuffer.Size - prim->IdxOffset;
+
+    // Not reusable if the indices went to another channel, or if a new command with a vertex offset was started (_VtxCurrentIdx was reset)
+    if (draw_list->_Splitter._Current == 0 && draw_list->_VtxCurrentIdx == prim->VtxCurrentIdx + (unsigned int)prim->VtxCount)
+        retained->Prims.push_back(*prim);
+}
+
+// Vertices modified after being written (ShadeVertsXXX functions): the modification may not be applied again, so don't reuse them next frame
+static void ImDrawListRetainInvalidate(ImDrawList* draw_list, int vtx_start_idx)
+{
+    ImVector<ImDrawRetainedPrim>& prims = draw_list->_Retained->Prims;
+    while (prims.Size > 0 && prims.back().VtxOffset + prims.back().VtxCount > vtx_start_idx)
+        prims.pop_back();
+}
+
 // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
 void ImDrawList::PushClipRect(ImVec2 cr_min, ImVec2 cr_max, bool intersect_with_current_clip_rect)
 {
@@ -540,6 +710,15 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
 }
 
+void ImDrawList::ReserveBuffers(int idx_count, int vtx_count)
+{
+    // Grow the same way as resize() does, so a hint slightly above the capacity doesn't lead to a series of small reallocations
+    if (IdxBuffer.Size + idx_count > IdxBuffer.Capacity)
+        IdxBuffer.reserve(IdxBuffer._grow_capacity(IdxBuffer.Size + idx_count));
+    if (VtxBuffer.Size + vtx_count > VtxBuffer.Capacity)
+        VtxBuffer.reserve(VtxBuffer._grow_capacity(VtxBuffer.Size + vtx_count));
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
@@ -590,30 +769,68 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } }
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 < 0.5f) d2 = 0.5f; float inv_lensq = 1.0f / d2; VX *= inv_lensq; VY *= inv_lensq; }
 
+// Tessellation of AddPolyline() and AddConvexPolyFilled() is split between indices, which only depend on the number of points, and vertices.
+// With ImDrawListFlags_DeferTessellation the indices are written immediately and the vertices later by TessellateDeferred(), possibly from another thread.
+static void PolylineWriteIdx(ImDrawIdx* idx_write, unsigned int vtx_current_idx, const int points_count, bool closed, bool thick_line, bool anti_aliased)
+{
+    const int count = closed ? points_count : points_count-1;
+    if (anti_aliased && !thick_line)
+    {
+        unsigned int idx1 = vtx_current_idx;
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            unsigned int idx2 = (i1+1) == points_count ? vtx_current_idx : idx1+3;
+            idx_write[0] = (ImDrawIdx)(idx2+0); idx_write[1] = (ImDrawIdx)(idx1+0); idx_write[2] = (ImDrawIdx)(idx1+2);
+            idx_write[3] = (ImDrawIdx)(idx1+2); idx_write[4] = (ImDrawIdx)(idx2+2); idx_write[5] = (ImDrawIdx)(idx2+0);
+            idx_write[6] = (ImDrawIdx)(idx2+1); idx_write[7] = (ImDrawIdx)(idx1+1); idx_write[8] = (ImDrawIdx)(idx1+0);
+            idx_write[9] = (ImDrawIdx)(idx1+0); idx_write[10]= (ImDrawIdx)(idx2+0); idx_write[11]= (ImDrawIdx)(idx2+1);
+            idx_write += 12;
+            idx1 = idx2;
+        }
+    }
+    else if (anti_aliased)
+    {
+        unsigned int idx1 = vtx_current_idx;
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            unsigned int idx2 = (i1+1) == points_count ? vtx_current_idx : idx1+4;
+            idx_write[0]  = (ImDrawIdx)(idx2+1); idx_write[1]  = (ImDrawIdx)(idx1+1); idx_write[2]  = (ImDrawIdx)(idx1+2);
+            idx_write[3]  = (ImDrawIdx)(idx1+2); idx_write[4]  = (ImDrawIdx)(idx2+2); idx_write[5]  = (ImDrawIdx)(idx2+1);
+            idx_write[6]  = (ImDrawIdx)(idx2+1); idx_write[7]  = (ImDrawIdx)(idx1+1); idx_write[8]  = (ImDrawIdx)(idx1+0);
+            idx_write[9]  = (ImDrawIdx)(idx1+0); idx_write[10] = (ImDrawIdx)(idx2+0); idx_write[11] = (ImDrawIdx)(idx2+1);
+            idx_write[12] = (ImDrawIdx)(idx2+2); idx_write[13] = (ImDrawIdx)(idx1+2); idx_write[14] = (ImDrawIdx)(idx1+3);
+            idx_write[15] = (ImDrawIdx)(idx1+3); idx_write[16] = (ImDrawIdx)(idx2+3); idx_write[17] = (ImDrawIdx)(idx2+2);
+            idx_write += 18;
+            idx1 = idx2;
+        }
+    }
+    else
+    {
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
+            idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
+            idx_write += 6;
+            vtx_current_idx += 4;
+        }
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
-void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
+static void PolylineWriteVtx(ImDrawVert* vtx_write, const ImVec2& uv, const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness, bool anti_aliased)
 {
-    if (points_count < 2)
-        return;
-
-    const ImVec2 uv = _Data->TexUvWhitePixel;
-
     int count = points_count;
     if (!closed)
         count = points_count-1;
 
     const bool thick_line = thickness > 1.0f;
-    if (Flags & ImDrawListFlags_AntiAliasedLines)
+    if (anti_aliased)
     {
         // Anti-aliased stroke
         const float AA_SIZE = 1.0f;
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
 
-        const int idx_count = thick_line ? count*18 : count*12;
-        const int vtx_count = thick_line ? points_count*4 : points_count*3;
-        PrimReserve(idx_count, vtx_count);
-
         // Temporary buffer
         ImVec2* temp_normals = (ImVec2*)alloca(points_count * (thick_line ? 5 : 3) * sizeof(ImVec2)); //-V630
         ImVec2* temp_points = temp_normals + points_count;
@@ -641,11 +858,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             }
 
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx;
             for (int i1 = 0; i1 < count; i1++)
             {
                 const int i2 = (i1+1) == points_count ? 0 : i1+1;
-                unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+3;
 
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
@@ -660,24 +875,15 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[0].y = points[i2].y + dm_y;
                 out_vtx[1].x = points[i2].x - dm_x;
                 out_vtx[1].y = points[i2].y - dm_y;
-
-                // Add indexes
-                _IdxWritePtr[0] = (ImDrawIdx)(idx2+0); _IdxWritePtr[1] = (ImDrawIdx)(idx1+0); _IdxWritePtr[2] = (ImDrawIdx)(idx1+2);
-                _IdxWritePtr[3] = (ImDrawIdx)(idx1+2); _IdxWritePtr[4] = (ImDrawIdx)(idx2+2); _IdxWritePtr[5] = (ImDrawIdx)(idx2+0);
-                _IdxWritePtr[6] = (ImDrawIdx)(idx2+1); _IdxWritePtr[7] = (ImDrawIdx)(idx1+1); _IdxWritePtr[8] = (ImDrawIdx)(idx1+0);
-                _IdxWritePtr[9] = (ImDrawIdx)(idx1+0); _IdxWritePtr[10]= (ImDrawIdx)(idx2+0); _IdxWritePtr[11]= (ImDrawIdx)(idx2+1);
-                _IdxWritePtr += 12;
-
-                idx1 = idx2;
             }
 
             // Add vertexes
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = points[i];          _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-                _VtxWritePtr[1].pos = temp_points[i*2+0]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;
-                _VtxWritePtr[2].pos = temp_points[i*2+1]; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col_trans;
-                _VtxWritePtr += 3;
+                vtx_write[0].pos = points[i];          vtx_write[0].uv = uv; vtx_write[0].col = col;
+                vtx_write[1].pos = temp_points[i*2+0]; vtx_write[1].uv = uv; vtx_write[1].col = col_trans;
+                vtx_write[2].pos = temp_points[i*2+1]; vtx_write[2].uv = uv; vtx_write[2].col = col_trans;
+                vtx_write += 3;
             }
         }
         else
@@ -696,11 +902,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             }
 
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx;
             for (int i1 = 0; i1 < count; i1++)
             {
                 const int i2 = (i1+1) == points_count ? 0 : i1+1;
-                unsigned int idx2 = (i1+1) == points_count ? _VtxCurrentIdx : idx1+4;
 
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
@@ -721,38 +925,22 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[2].y = points[i2].y - dm_in_y;
                 out_vtx[3].x = points[i2].x - dm_out_x;
                 out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
-                _IdxWritePtr[0]  = (ImDrawIdx)(idx2+1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1+1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1+2);
-                _IdxWritePtr[3]  = (ImDrawIdx)(idx1+2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2+2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2+1);
-                _IdxWritePtr[6]  = (ImDrawIdx)(idx2+1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1+1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1+0);
-                _IdxWritePtr[9]  = (ImDrawIdx)(idx1+0); _IdxWritePtr[10] = (ImDrawIdx)(idx2+0); _IdxWritePtr[11] = (ImDrawIdx)(idx2+1);
-                _IdxWritePtr[12] = (ImDrawIdx)(idx2+2); _IdxWritePtr[13] = (ImDrawIdx)(idx1+2); _IdxWritePtr[14] = (ImDrawIdx)(idx1+3);
-                _IdxWritePtr[15] = (ImDrawIdx)(idx1+3); _IdxWritePtr[16] = (ImDrawIdx)(idx2+3); _IdxWritePtr[17] = (ImDrawIdx)(idx2+2);
-                _IdxWritePtr += 18;
-
-                idx1 = idx2;
             }
 
             // Add vertexes
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i*4+0]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i*4+1]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i*4+2]; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i*4+3]; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
+                vtx_write[0].pos = temp_points[i*4+0]; vtx_write[0].uv = uv; vtx_write[0].col = col_trans;
+                vtx_write[1].pos = temp_points[i*4+1]; vtx_write[1].uv = uv; vtx_write[1].col = col;
+                vtx_write[2].pos = temp_points[i*4+2]; vtx_write[2].uv = uv; vtx_write[2].col = col;
+                vtx_write[3].pos = temp_points[i*4+3]; vtx_write[3].uv = uv; vtx_write[3].col = col_trans;
+                vtx_write += 4;
             }
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
     {
         // Non Anti-aliased Stroke
-        const int idx_count = count*6;
-        const int vtx_count = count*4;      // FIXME-OPT: Not sharing edges
-        PrimReserve(idx_count, vtx_count);
-
         for (int i1 = 0; i1 < count; i1++)
         {
             const int i2 = (i1+1) == points_count ? 0 : i1+1;
@@ -765,45 +953,101 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
-            _VtxWritePtr += 4;
-
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx+1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx+2);
-            _IdxWritePtr[3] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[4] = (ImDrawIdx)(_VtxCurrentIdx+2); _IdxWritePtr[5] = (ImDrawIdx)(_VtxCurrentIdx+3);
-            _IdxWritePtr += 6;
-            _VtxCurrentIdx += 4;
+            vtx_write[0].pos = ImVec2(p1.x + dy, p1.y - dx); vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write[1].pos = ImVec2(p2.x + dy, p2.y - dx); vtx_write[1].uv = uv; vtx_write[1].col = col;
+            vtx_write[2].pos = ImVec2(p2.x - dy, p2.y + dx); vtx_write[2].uv = uv; vtx_write[2].col = col;
+            vtx_write[3].pos = ImVec2(p1.x - dy, p1.y + dx); vtx_write[3].uv = uv; vtx_write[3].col = col;
+            vtx_write += 4;
         }
     }
 }
 
-// We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
-void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
 {
-    if (points_count < 3)
+    if (points_count < 2)
         return;
 
-    const ImVec2 uv = _Data->TexUvWhitePixel;
+    ImDrawRetainedPrim retained_prim;
+    if (Flags & ImDrawListFlags_RetainTessellation)
+    {
+        const struct { ImVec2 TexUvWhitePixel; ImU32 Col; float Thickness; int Closed; int Flags; } params = { _Data->TexUvWhitePixel, col, thickness, closed ? 1 : 0, Flags & ImDrawListFlags_AntiAliasedLines };
+        if (ImDrawListRetainBegin(this, &params, sizeof(params), points, points_count * sizeof(ImVec2), &retained_prim))
+            return;
+    }
 
-    if (Flags & ImDrawListFlags_AntiAliasedFill)
+    const int count = closed ? points_count : points_count-1;
+    const bool thick_line = thickness > 1.0f;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const int idx_count = anti_aliased ? (thick_line ? count*18 : count*12) : count*6;
+    const int vtx_count = anti_aliased ? (thick_line ? points_count*4 : points_count*3) : count*4; // FIXME-OPT: Not sharing edges in the non anti-aliased stroke
+    PrimReserve(idx_count, vtx_count);
+    PolylineWriteIdx(_IdxWritePtr, _VtxCurrentIdx, points_count, closed, thick_line, anti_aliased);
+    if (Flags & ImDrawListFlags_DeferTessellation)
     {
-        // Anti-aliased Fill
-        const float AA_SIZE = 1.0f;
-        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-        const int idx_count = (points_count-2)*3 + points_count*6;
-        const int vtx_count = (points_count*2);
-        PrimReserve(idx_count, vtx_count);
+        ImDrawDeferredPrim prim;
+        prim.VtxOffset = (int)(_VtxWritePtr - VtxBuffer.Data);
+        prim.PointsOffset = _DeferredPoints.Size;
+        prim.PointsCount = points_count;
+        prim.Col = col;
+        prim.Thickness = thickness;
+        prim.Filled = false;
+        prim.Closed = closed;
+        prim.AntiAliased = anti_aliased;
+        _DeferredPrims.push_back(prim);
+        _DeferredPoints.resize(_DeferredPoints.Size + points_count);
+        memcpy(_DeferredPoints.Data + prim.PointsOffset, points, points_count * sizeof(ImVec2));
+    }
+    else
+    {
+        PolylineWriteVtx(_VtxWritePtr, _Data->TexUvWhitePixel, points, points_count, col, closed, thickness, anti_aliased);
+    }
+    _VtxWritePtr += vtx_count;
+    _IdxWritePtr += idx_count;
+    _VtxCurrentIdx += (ImDrawIdx)vtx_count;
 
+    if (Flags & ImDrawListFlags_RetainTessellation)
+        ImDrawListRetainEnd(this, &retained_prim);
+}
+
+static void ConvexPolyFilledWriteIdx(ImDrawIdx* idx_write, unsigned int vtx_current_idx, const int points_count, bool anti_aliased)
+{
+    if (anti_aliased)
+    {
         // Add indexes for fill
-        unsigned int vtx_inner_idx = _VtxCurrentIdx;
-        unsigned int vtx_outer_idx = _VtxCurrentIdx+1;
+        unsigned int vtx_inner_idx = vtx_current_idx;
+        unsigned int vtx_outer_idx = vtx_current_idx+1;
         for (int i = 2; i < points_count; i++)
         {
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx+((i-1)<<1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx+(i<<1));
-            _IdxWritePtr += 3;
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx); idx_write[1] = (ImDrawIdx)(vtx_inner_idx+((i-1)<<1)); idx_write[2] = (ImDrawIdx)(vtx_inner_idx+(i<<1));
+            idx_write += 3;
+        }
+
+        // Add indexes for fringes
+        for (int i0 = points_count-1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_inner_idx+(i1<<1)); idx_write[1] = (ImDrawIdx)(vtx_inner_idx+(i0<<1)); idx_write[2] = (ImDrawIdx)(vtx_outer_idx+(i0<<1));
+            idx_write[3] = (ImDrawIdx)(vtx_outer_idx+(i0<<1)); idx_write[4] = (ImDrawIdx)(vtx_outer_idx+(i1<<1)); idx_write[5] = (ImDrawIdx)(vtx_inner_idx+(i1<<1));
+            idx_write += 6;
         }
+    }
+    else
+    {
+        for (int i = 2; i < points_count; i++)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+i-1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+i);
+            idx_write += 3;
+        }
+    }
+}
+
+// We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
+static void ConvexPolyFilledWriteVtx(ImDrawVert* vtx_write, const ImVec2& uv, const ImVec2* points, const int points_count, ImU32 col, bool anti_aliased)
+{
+    if (anti_aliased)
+    {
+        // Anti-aliased Fill
+        const float AA_SIZE = 1.0f;
+        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
 
         // Compute normals
         ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
@@ -830,37 +1074,92 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
-            _VtxWritePtr += 2;
-
-            // Add indexes for fringes
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx+(i1<<1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx+(i0<<1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx+(i0<<1));
-            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx+(i0<<1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx+(i1<<1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx+(i1<<1));
-            _IdxWritePtr += 6;
+            vtx_write[0].pos = ImVec2((points[i1].x - dm_x), (points[i1].y - dm_y)); vtx_write[0].uv = uv; vtx_write[0].col = col;        // Inner
+            vtx_write[1].pos = ImVec2((points[i1].x + dm_x), (points[i1].y + dm_y)); vtx_write[1].uv = uv; vtx_write[1].col = col_trans;  // Outer
+            vtx_write += 2;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
     {
         // Non Anti-aliased Fill
-        const int idx_count = (points_count-2)*3;
-        const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
-        for (int i = 0; i < vtx_count; i++)
-        {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr++;
-        }
-        for (int i = 2; i < points_count; i++)
+        for (int i = 0; i < points_count; i++)
         {
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx+i-1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx+i);
-            _IdxWritePtr += 3;
+            vtx_write[0].pos = points[i]; vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write++;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
 }
 
+void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
+    if (points_count < 3)
+        return;
+
+    ImDrawRetainedPrim retained_prim;
+    if (Flags & ImDrawListFlags_RetainTessellation)
+    {
+        const struct { ImVec2 TexUvWhitePixel; ImU32 Col; int Flags; } params = { _Data->TexUvWhitePixel, col, Flags & ImDrawListFlags_AntiAliasedFill };
+        if (ImDrawListRetainBegin(this, &params, sizeof(params), points, points_count * sizeof(ImVec2), &retained_prim))
+            return;
+    }
+
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const int idx_count = anti_aliased ? (points_count-2)*3 + points_count*6 : (points_count-2)*3;
+    const int vtx_count = anti_aliased ? (points_count*2) : points_count;
+    PrimReserve(idx_count, vtx_count);
+    ConvexPolyFilledWriteIdx(_IdxWritePtr, _VtxCurrentIdx, points_count, anti_aliased);
+    if (Flags & ImDrawListFlags_DeferTessellation)
+    {
+        ImDrawDeferredPrim prim;
+        prim.VtxOffset = (int)(_VtxWritePtr - VtxBuffer.Data);
+        prim.PointsOffset = _DeferredPoints.Size;
+        prim.PointsCount = points_count;
+        prim.Col = col;
+        prim.Thickness = 0.0f;
+        prim.Filled = true;
+        prim.Closed = true;
+        prim.AntiAliased = anti_aliased;
+        _DeferredPrims.push_back(prim);
+        _DeferredPoints.resize(_DeferredPoints.Size + points_count);
+        memcpy(_DeferredPoints.Data + prim.PointsOffset, points, points_count * sizeof(ImVec2));
+    }
+    else
+    {
+        ConvexPolyFilledWriteVtx(_VtxWritePtr, _Data->TexUvWhitePixel, points, points_count, col, anti_aliased);
+    }
+    _VtxWritePtr += vtx_count;
+    _IdxWritePtr += idx_count;
+    _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+
+    if (Flags & ImDrawListFlags_RetainTessellation)
+        ImDrawListRetainEnd(this, &retained_prim);
+}
+
+// Primitives recorded with ImDrawListFlags_DeferTessellation only read their own points and write their own reserved vertices,
+// so different ranges can be processed concurrently (this is what ImGui::Render() does when io.ParallelForFn is set).
+void ImDrawList::TessellateDeferredRange(int prim_begin, int prim_end)
+{
+    IM_ASSERT(prim_begin >= 0 && prim_begin <= prim_end && prim_end <= _DeferredPrims.Size);
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    for (int prim_n = prim_begin; prim_n < prim_end; prim_n++)
+    {
+        const ImDrawDeferredPrim& prim = _DeferredPrims[prim_n];
+        ImDrawVert* vtx_write = VtxBuffer.Data + prim.VtxOffset;
+        const ImVec2* points = _DeferredPoints.Data + prim.PointsOffset;
+        if (prim.Filled)
+            ConvexPolyFilledWriteVtx(vtx_write, uv, points, prim.PointsCount, prim.Col, prim.AntiAliased);
+        else
+            PolylineWriteVtx(vtx_write, uv, points, prim.PointsCount, prim.Col, prim.Closed, prim.Thickness, prim.AntiAliased);
+    }
+}
+
+void ImDrawList::TessellateDeferred()
+{
+    TessellateDeferredRange(0, _DeferredPrims.Size);
+    _DeferredPrims.resize(0);
+    _DeferredPoints.resize(0);
+}
+
 void ImDrawList::PathArcToFast(const ImVec2& centre, float radius, int a_min_of_12, int a_max_of_12)
 {
     if (radius == 0.0f || a_min_of_12 > a_max_of_12)
@@ -1125,7 +1424,21 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
         clip_rect.z = ImMin(clip_rect.z, cpu_fine_clip_rect->z);
         clip_rect.w = ImMin(clip_rect.w, cpu_fine_clip_rect->w);
     }
+
+    // Glyphs rasterized on demand are only kept in the atlas while RenderText() looks them up, so their output can't be reused
+    ImDrawRetainedPrim retained_prim;
+    const bool retain = (Flags & ImDrawListFlags_RetainTessellation) && !(font->ContainerAtlas->Flags & ImFontAtlasFlags_DynamicGlyphs);
+    if (retain)
+    {
+        const struct { const ImFont* Font; ImVec4 ClipRect; ImVec2 Pos; float FontSize; float WrapWidth; ImU32 Col; int CpuFineClip; } params = { font, clip_rect, pos, font_size, wrap_width, col, cpu_fine_clip_rect ? 1 : 0 };
+        if (ImDrawListRetainBegin(this, &params, sizeof(params), text_begin, (size_t)(text_end - text_begin), &retained_prim))
+            return;
+    }
+
     font->RenderText(this, font_size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip_rect != NULL);
+
+    if (retain)
+        ImDrawListRetainEnd(this, &retained_prim);
 }
 
 void ImDrawList::AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end)
@@ -1392,6 +1705,230 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     }
 }
 
+int ImDrawData::FlattenInto(ImDrawList* out_list, bool rebase_indices) const
+{
+    ImVector<ImDrawFlattenList> lists;
+    const int segments_count = ImDrawDataFlattenLayout(this, out_list, rebase_indices, &lists);
+    for (int n = 0; n < lists.Size; n++)
+        ImDrawDataFlattenCopy(out_list, lists[n]);
+    return segments_count;
+}
+
+// Lay out the concatenation of all draw lists of 'draw_data' in 'out_list': size its buffers, write its commands, and output where each draw list is copied.
+// Indices are rebased so that commands share the same VtxOffset until 16-bit indices would overflow. Draw lists using VtxOffset themselves (or all of them
+// when 'rebase_indices' is false) have their indices copied as-is and their commands VtxOffset moved to their vertices. Returns the number of distinct VtxOffset.
+int ImDrawDataFlattenLayout(const ImDrawData* draw_data, ImDrawList* out_list, bool rebase_indices, ImVector<ImDrawFlattenList>* out_lists)
+{
+    int vtx_total = 0, idx_total = 0, cmd_total = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* src = draw_data->CmdLists[n];
+        vtx_total += src->VtxBuffer.Size;
+        idx_total += src->IdxBuffer.Size;
+        cmd_total += src->CmdBuffer.Size;
+    }
+    out_list->CmdBuffer.resize(0);
+    out_list->CmdBuffer.reserve(cmd_total);
+    out_list->VtxBuffer.resize(vtx_total);
+    out_list->IdxBuffer.resize(idx_total);
+    out_list->_VtxWritePtr = out_list->VtxBuffer.Data + vtx_total;
+    out_list->_IdxWritePtr = out_list->IdxBuffer.Data + idx_total;
+    out_lists->resize(draw_data->CmdListsCount);
+
+    int vtx_dst = 0, idx_dst = 0, segments_count = 0;
+    unsigned int segment_start = 0; // Rebased indices are relative to this vertex
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* src = draw_data->CmdLists[n];
+        const bool rebase = rebase_indices && (src->CmdBuffer.Size == 0 || src->CmdBuffer.back().VtxOffset == 0);
+        if (rebase && sizeof(ImDrawIdx) == 2 && (unsigned int)(vtx_dst + src->VtxBuffer.Size) - segment_start > (1 << 16))
+            segment_start = (unsigned int)vtx_dst;
+
+        ImDrawFlattenList& list = (*out_lists)[n];
+        list.Src = src;
+        list.VtxDst = vtx_dst;
+        list.IdxDst = idx_dst;
+        list.IdxRebase = rebase ? (unsigned int)vtx_dst - segment_start : 0;
+        for (int cmd_n = 0; cmd_n < src->CmdBuffer.Size; cmd_n++)
+        {
+            ImDrawCmd cmd = src->CmdBuffer.Data[cmd_n];
+            cmd.IdxOffset += (unsigned int)idx_dst;
+            cmd.VtxOffset = rebase ? segment_start : (unsigned int)vtx_dst + cmd.VtxOffset;
+            if (out_list->CmdBuffer.Size == 0 || out_list->CmdBuffer.back().VtxOffset != cmd.VtxOffset)
+                segments_count++;
+            out_list->CmdBuffer.push_back(cmd);
+        }
+        vtx_dst += src->VtxBuffer.Size;
+        idx_dst += src->IdxBuffer.Size;
+    }
+    return segments_count;
+}
+
+// Return the bounding box of the vertices used by 'elem_count' indices from 'idx_offset' (an inverted rectangle if 'elem_count' is 0).
+// We use the range of vertices between the lowest and highest index, which is generally the exact set of vertices used by a command.
+ImRect ImDrawIdxRangeCalcVtxBounds(const ImDrawList* draw_list, unsigned int vtx_offset, unsigned int idx_offset, unsigned int elem_count)
+{
+    if (elem_count == 0)
+        return ImRect();
+    const ImDrawIdx* idx = draw_list->IdxBuffer.Data + idx_offset;
+    unsigned int idx_min = idx[0], idx_max = idx[0];
+    unsigned int n = 1;
+#ifdef IMGUI_ENABLE_SSE
+    if (sizeof(ImDrawIdx) == 2 && elem_count >= 16)
+    {
+        // SSE2 only has signed 16-bit min/max: flip the sign bit to preserve the unsigned order
+        const __m128i sign = _mm_set1_epi16((short)0x8000);
+        __m128i v_min = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(const void*)idx), sign);
+        __m128i v_max = v_min;
+        for (n = 8; n + 8 <= elem_count; n += 8)
+        {
+            const __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(const void*)(idx + n)), sign);
+            v_min = _mm_min_epi16(v_min, v);
+            v_max = _mm_max_epi16(v_max, v);
+        }
+        ImU16 lanes_min[8], lanes_max[8];
+        _mm_storeu_si128((__m128i*)(void*)lanes_min, _mm_xor_si128(v_min, sign));
+        _mm_storeu_si128((__m128i*)(void*)lanes_max, _mm_xor_si128(v_max, sign));
+        for (int lane = 0; lane < 8; lane++)
+        {
+            idx_min = ImMin(idx_min, (unsigned int)lanes_min[lane]);
+            idx_max = ImMax(idx_max, (unsigned int)lanes_max[lane]);
+        }
+    }
+#endif
+    for (; n < elem_count; n++)
+    {
+        idx_min = ImMin(idx_min, (unsigned int)idx[n]);
+        idx_max = ImMax(idx_max, (unsigned int)idx[n]);
+    }
+    const ImDrawVert* vtx = draw_list->VtxBuffer.Data + vtx_offset + idx_min;
+    const ImDrawVert* vtx_end = draw_list->VtxBuffer.Data + vtx_offset + idx_max + 1;
+    ImVec2 vtx_min(FLT_MAX, FLT_MAX), vtx_max(-FLT_MAX, -FLT_MAX);
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+    __m128 v_min_0 = _mm_set1_ps(FLT_MAX), v_max_0 = _mm_set1_ps(-FLT_MAX);
+    __m128 v_min_1 = v_min_0, v_max_1 = v_max_0;
+    for (; vtx + 2 <= vtx_end; vtx += 2)
+    {
+        const __m128 pos_0 = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)(const void*)&vtx[0].pos));
+        const __m128 pos_1 = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)(const void*)&vtx[1].pos));
+        v_min_0 = _mm_min_ps(v_min_0, pos_0);
+        v_max_0 = _mm_max_ps(v_max_0, pos_0);
+        v_min_1 = _mm_min_ps(v_min_1, pos_1);
+        v_max_1 = _mm_max_ps(v_max_1, pos_1);
+    }
+    _mm_storel_pi((__m64*)(void*)&vtx_min, _mm_min_ps(v_min_0, v_min_1));
+    _mm_storel_pi((__m64*)(void*)&vtx_max, _mm_max_ps(v_max_0, v_max_1));
+#elif defined(IMGUI_USE_COMPACT_DRAWVERT) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+    // Compare fixed-point positions and only convert the result
+    if (vtx < vtx_end)
+    {
+        ImDrawVertPos16 pos_min = vtx->pos, pos_max = vtx->pos;
+        for (vtx++; vtx < vtx_end; vtx++)
+        {
+            pos_min.X = ImMin(pos_min.X, vtx->pos.X); pos_min.Y = ImMin(pos_min.Y, vtx->pos.Y);
+            pos_max.X = ImMax(pos_max.X, vtx->pos.X); pos_max.Y = ImMax(pos_max.Y, vtx->pos.Y);
+        }
+        vtx_min = pos_min;
+        vtx_max = pos_max;
+    }
+#endif
+    for (; vtx < vtx_end; vtx++)
+    {
+        vtx_min = ImMin(vtx_min, vtx->pos);
+        vtx_max = ImMax(vtx_max, vtx->pos);
+    }
+    return ImRect(vtx_min, vtx_max);
+}
+
+// Merge adjacent commands with the same texture and VtxOffset, contiguous indices and no callback, if they have the same clip rectangle,
+// or if both have all their vertices inside their own clip rectangle (the merged command then uses the union of both clip rectangles).
+// The second case is what allows merging commands of different windows once the draw lists have been flattened with FlattenInto().
+// Vertices are tested lazily and at most once: 'dst_checked_end' is the end of the indices of dst_cmd already tested against its clip rectangle.
+int ImDrawData::MergeDrawCmds()
+{
+    int removed_count = 0;
+    for (int list_n = 0; list_n < CmdListsCount; list_n++)
+    {
+        ImDrawList* draw_list = CmdLists[list_n];
+        ImDrawCmd* dst_cmd = NULL;
+        bool dst_inside = true;
+        unsigned int dst_checked_end = 0;
+        int dst_n = 0;
+        for (int src_n = 0; src_n < draw_list->CmdBuffer.Size; src_n++)
+        {
+            const ImDrawCmd& src_cmd = draw_list->CmdBuffer.Data[src_n];
+            if (src_cmd.ElemCount == 0 && src_cmd.UserCallback == NULL)
+                continue;
+            bool src_inside = true;
+            unsigned int src_checked_end = src_cmd.IdxOffset;
+            if (dst_cmd && dst_cmd->UserCallback == NULL && src_cmd.UserCallback == NULL && dst_cmd->TextureId == src_cmd.TextureId && dst_cmd->VtxOffset == src_cmd.VtxOffset && dst_cmd->IdxOffset + dst_cmd->ElemCount == src_cmd.IdxOffset)
+            {
+                if (memcmp(&dst_cmd->ClipRect, &src_cmd.ClipRect, sizeof(ImVec4)) == 0)
+                {
+                    dst_cmd->ElemCount += src_cmd.ElemCount;
+                    continue;
+                }
+                const unsigned int dst_end = dst_cmd->IdxOffset + dst_cmd->ElemCount;
+                if (dst_inside && dst_checked_end < dst_end)
+                    dst_inside = ImRect(dst_cmd->ClipRect).Contains(ImDrawIdxRangeCalcVtxBounds(draw_list, dst_cmd->VtxOffset, dst_checked_end, dst_end - dst_checked_end));
+                dst_checked_end = dst_end;
+                if (dst_inside)
+                {
+                    src_inside = ImRect(src_cmd.ClipRect).Contains(ImDrawIdxRangeCalcVtxBounds(draw_list, src_cmd.VtxOffset, src_cmd.IdxOffset, src_cmd.ElemCount));
+                    src_checked_end = src_cmd.IdxOffset + src_cmd.ElemCount;
+                    if (src_inside)
+                    {
+                        dst_cmd->ClipRect = ImVec4(ImMin(dst_cmd->ClipRect.x, src_cmd.ClipRect.x), ImMin(dst_cmd->ClipRect.y, src_cmd.ClipRect.y), ImMax(dst_cmd->ClipRect.z, src_cmd.ClipRect.z), ImMax(dst_cmd->ClipRect.w, src_cmd.ClipRect.w));
+                        dst_cmd->ElemCount += src_cmd.ElemCount;
+                        dst_checked_end = src_checked_end;
+                        continue;
+                    }
+                }
+            }
+            dst_cmd = &draw_list->CmdBuffer.Data[dst_n++];
+            *dst_cmd = src_cmd;
+            dst_inside = src_inside;
+            dst_checked_end = src_checked_end;
+        }
+        removed_count += draw_list->CmdBuffer.Size - dst_n;
+        draw_list->CmdBuffer.resize(dst_n);
+    }
+    return removed_count;
+}
+
+// Copy 'count' indices, adding 'rebase' to each of them
+static void ImDrawIdxCopyRebased(ImDrawIdx* dst, const ImDrawIdx* src, int count, unsigned int rebase)
+{
+    int n = 0;
+#ifdef IMGUI_ENABLE_SSE
+    if (sizeof(ImDrawIdx) == 2)
+    {
+        const __m128i rebase_v = _mm_set1_epi16((short)rebase);
+        for (; n + 8 <= count; n += 8)
+            _mm_storeu_si128((__m128i*)(void*)(dst + n), _mm_add_epi16(_mm_loadu_si128((const __m128i*)(const void*)(src + n)), rebase_v));
+    }
+    else if (sizeof(ImDrawIdx) == 4)
+    {
+        const __m128i rebase_v = _mm_set1_epi32((int)rebase);
+        for (; n + 4 <= count; n += 4)
+            _mm_storeu_si128((__m128i*)(void*)(dst + n), _mm_add_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + n)), rebase_v));
+    }
+#endif
+    for (; n < count; n++)
+        dst[n] = (ImDrawIdx)(src[n] + rebase);
+}
+
+// Copy the vertices and indices of a draw list laid out by ImDrawDataFlattenLayout(). Different draw lists may be copied concurrently.
+void ImDrawDataFlattenCopy(ImDrawList* out_list, const ImDrawFlattenList& list)
+{
+    const ImDrawList* src = list.Src;
+    memcpy(out_list->VtxBuffer.Data + list.VtxDst, src->VtxBuffer.Data, (size_t)src->VtxBuffer.size_in_bytes());
+    if (list.IdxRebase == 0)
+        memcpy(out_list->IdxBuffer.Data + list.IdxDst, src->IdxBuffer.Data, (size_t)src->IdxBuffer.size_in_bytes());
+    else
+        ImDrawIdxCopyRebased(out_list->IdxBuffer.Data + list.IdxDst, src->IdxBuffer.Data, src->IdxBuffer.Size, list.IdxRebase);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -1399,6 +1936,10 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
 // Generic linear color gradient, write to RGB fields, leave A untouched.
 void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
 {
+    if (draw_list->Flags & ImDrawListFlags_RetainTessellation)
+        ImDrawListRetainInvalidate(draw_list, vert_start_idx);
+    if (draw_list->_DeferredPrims.Size > 0)
+        draw_list->TessellateDeferred();
     ImVec2 gradient_extent = gradient_p1 - gradient_p0;
     float gradient_inv_length2 = 1.0f / ImLengthSqr(gradient_extent);
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
@@ -1417,6 +1958,10 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
 // Distribute UV over (a, b) rectangle
 void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp)
 {
+    if (draw_list->Flags & ImDrawListFlags_RetainTessellation)
+        ImDrawListRetainInvalidate(draw_list, vert_start_idx);
+    if (draw_list->_DeferredPrims.Size > 0)
+        draw_list->TessellateDeferred();
     const ImVec2 size = b - a;
     const ImVec2 uv_size = uv_b - uv_a;
     const ImVec2 scale = ImVec2(
@@ -1430,12 +1975,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos) - a, scale), min, max);
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos) - a, scale);
     }
 }
 
@@ -1518,6 +2063,12 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(91,0), ImVec2(17,22), ImVec2( 5, 0) }, // ImGuiMouseCursor_Hand
 };
 
+struct ImFontBuildDynamicRef;
+static void ImFontAtlasBuildDynamicInit(ImFontAtlas* atlas, const ImVector<ImFontBuildDynamicRef>& refs, int cache_y);
+static void ImFontAtlasBuildDynamicDestroy(ImFontAtlas* atlas);
+static void ImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas, int font_index, int glyph_index);
+static bool ImFontAtlasDynamicIsBuiltGlyph(const ImFontAtlas* atlas, int font_index, int glyph_index);
+
 ImFontAtlas::ImFontAtlas()
 {
     Locked = false;
@@ -1525,6 +2076,10 @@ ImFontAtlas::ImFontAtlas()
     TexID = (ImTextureID)NULL;
     TexDesiredWidth = 0;
     TexGlyphPadding = 1;
+    TexDynamicCacheHeight = 1024;
+    ParallelForFn = NULL;
+    ParallelForUserData = NULL;
+    CacheFilename = NULL;
 
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
@@ -1533,6 +2088,9 @@ ImFontAtlas::ImFontAtlas()
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     for (int n = 0; n < IM_ARRAYSIZE(CustomRectIds); n++)
         CustomRectIds[n] = -1;
+    DynamicData = NULL;
+    DynamicFrameCount = 0;
+    DynamicGlyphsRasterizedCount = DynamicGlyphsEvictedCount = DynamicGlyphsOverflowCount = 0;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -1544,6 +2102,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDynamicDestroy(this); // Refers to the TTF data
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -1567,6 +2126,7 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDynamicDestroy(this); // Glyphs which are not resident will stay blank
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -1578,6 +2138,7 @@ void    ImFontAtlas::ClearTexData()
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDynamicDestroy(this);
     for (int i = 0; i < Fonts.Size; i++)
         IM_DELETE(Fonts[i]);
     Fonts.clear();
@@ -1814,7 +2375,14 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 bool    ImFontAtlas::Build()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
-    return ImFontAtlasBuildWithStbTruetype(this);
+    if (CacheFilename == NULL || (Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return ImFontAtlasBuildWithStbTruetype(this);
+    if (ImFontAtlasBuildLoadCache(this, CacheFilename))
+        return true;
+    if (!ImFontAtlasBuildWithStbTruetype(this))
+        return false;
+    ImFontAtlasBuildSaveCache(this, CacheFilename);
+    return true;
 }
 
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
@@ -1848,6 +2416,7 @@ struct ImFontBuildSrcData
     int                 GlyphsCount;        // Glyph count (excluding missing glyphs and glyphs already set by an earlier source font)
     ImBoolVector        GlyphsSet;          // Glyph bit map (random access, 1-bit per codepoint. This will be a maximum of 8KB)
     ImVector<int>       GlyphsList;         // Glyph codepoints list (flattened version of GlyphsMap)
+    ImVector<int>       GlyphsListDynamic;  // Glyph codepoints rasterized on first use (ImFontAtlasFlags_DynamicGlyphs)
 };
 
 // Temporary data for one destination ImFont* (multiple source fonts can be merged into one destination ImFont)
@@ -1859,6 +2428,66 @@ struct ImFontBuildDstData
     ImBoolVector        GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Glyph registered by Build() without being rasterized (ImFontAtlasFlags_DynamicGlyphs)
+struct ImFontBuildDynamicRef
+{
+    int                 DstIndex;           // Index into atlas->Fonts[]
+    int                 GlyphIndex;         // Index into atlas->Fonts[DstIndex]->Glyphs[]
+    int                 SrcIndex;           // Index into atlas->ConfigData[]
+};
+
+// Rasterization job: a range of glyphs of one input font, packed but not rendered yet (step 8 of ImFontAtlasBuildWithStbTruetype)
+#define FONT_ATLAS_RASTER_JOB_GLYPHS    128
+
+struct ImFontBuildRasterJob
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[]
+    int                 GlyphsStart;        // Index into ImFontBuildSrcData::GlyphsList[]
+    int                 GlyphsCount;
+};
+
+struct ImFontBuildRasterJobs
+{
+    ImFontAtlas*                Atlas;
+    ImFontBuildSrcData*         SrcData;
+    const stbtt_pack_context*   PackContext;
+    const ImFontBuildRasterJob* Jobs;
+    bool                        Parallel;
+};
+
+// Glyph rectangles don't overlap, so jobs can run in any order and on any thread and still output the same pixels.
+static void ImFontAtlasBuildRasterJobFunc(void* data, int job_n)
+{
+    const ImFontBuildRasterJobs* jobs = (const ImFontBuildRasterJobs*)data;
+    const ImFontBuildRasterJob& job = jobs->Jobs[job_n];
+    ImFontAtlas* atlas = jobs->Atlas;
+    const ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+    ImFontBuildSrcData& src_tmp = jobs->SrcData[job.SrcIndex];
+
+    // stbtt_PackFontRangesRenderIntoRects() temporarily modifies the pack context, so each job uses its own copy.
+    // A non-NULL userdata makes stb_truetype allocate with MemAllocUntracked(), as the context may not be used from worker threads (see STBTT_malloc).
+    stbtt_pack_context spc = *jobs->PackContext;
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    font_info.userdata = jobs->Parallel ? atlas : NULL;
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints += job.GlyphsStart;
+    pack_range.chardata_for_range += job.GlyphsStart;
+    pack_range.num_chars = job.GlyphsCount;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphsStart;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = rects;
+        for (int glyph_i = 0; glyph_i < job.GlyphsCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
 static void UnpackBoolVectorToFlatIndexList(const ImBoolVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -1951,6 +2580,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 3. Unpack our bit map into a flat list (we now have all the Unicode points that we know are requested _and_ available _and_ not overlapping another)
+    int dynamic_glyphs_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
@@ -1958,6 +2588,26 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         UnpackBoolVectorToFlatIndexList(&src_tmp.GlyphsSet, &src_tmp.GlyphsList);
         src_tmp.GlyphsSet.Clear();
         IM_ASSERT(src_tmp.GlyphsList.Size == src_tmp.GlyphsCount);
+
+        // With ImFontAtlasFlags_DynamicGlyphs, only ASCII and the fallback character are packed now. Other glyphs are rasterized on first use.
+        if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+        {
+            const int fallback_char = (int)atlas->ConfigData[src_i].DstFont->FallbackChar;
+            int static_count = 0;
+            src_tmp.GlyphsListDynamic.reserve(src_tmp.GlyphsCount);
+            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+            {
+                const int codepoint = src_tmp.GlyphsList[glyph_i];
+                if (codepoint < 0x80 || codepoint == fallback_char)
+                    src_tmp.GlyphsList[static_count++] = codepoint;
+                else
+                    src_tmp.GlyphsListDynamic.push_back(codepoint);
+            }
+            src_tmp.GlyphsList.resize(static_count);
+            src_tmp.GlyphsCount = static_count;
+            total_glyphs_count -= src_tmp.GlyphsListDynamic.Size;
+            dynamic_glyphs_count += src_tmp.GlyphsListDynamic.Size;
+        }
     }
     for (int dst_i = 0; dst_i < dst_tmp_array.Size; dst_i++)
         dst_tmp_array[dst_i].GlyphsSet.Clear();
@@ -2021,6 +2671,8 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         atlas->TexWidth = atlas->TexDesiredWidth;
     else
         atlas->TexWidth = (surface_sqrt >= 4096*0.7f) ? 4096 : (surface_sqrt >= 2048*0.7f) ? 2048 : (surface_sqrt >= 1024*0.7f) ? 1024 : 512;
+    if (dynamic_glyphs_count > 0 && atlas->TexDesiredWidth <= 0)
+        atlas->TexWidth = ImMax(atlas->TexWidth, 1024);
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
@@ -2046,6 +2698,10 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 7. Allocate texture
+    // With ImFontAtlasFlags_DynamicGlyphs, the area below packed glyphs is used as a cache for glyphs rasterized on demand.
+    const int dynamic_cache_y = atlas->TexHeight;
+    if (dynamic_glyphs_count > 0)
+        atlas->TexHeight += ImMax(atlas->TexDynamicCacheHeight, 0);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
@@ -2054,37 +2710,49 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // Glyphs are split into jobs of FONT_ATLAS_RASTER_JOB_GLYPHS, which are run in parallel with atlas->ParallelForFn (or io.ParallelForFn) if provided.
+    ImVector<ImFontBuildRasterJob> raster_jobs;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += FONT_ATLAS_RASTER_JOB_GLYPHS)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRasterJob job;
+            job.SrcIndex = src_i;
+            job.GlyphsStart = glyph_i;
+            job.GlyphsCount = ImMin(src_tmp_array[src_i].GlyphsCount - glyph_i, FONT_ATLAS_RASTER_JOB_GLYPHS);
+            raster_jobs.push_back(job);
         }
-        src_tmp.Rects = NULL;
+    void (*parallel_for_fn)(void* user_data, void (*func)(void* data, int n), void* data, int count) = atlas->ParallelForFn;
+    void* parallel_for_user_data = atlas->ParallelForUserData;
+    if (parallel_for_fn == NULL && GImGui != NULL)
+    {
+        parallel_for_fn = GImGui->IO.ParallelForFn;
+        parallel_for_user_data = GImGui->IO.ParallelForUserData;
     }
+    ImFontBuildRasterJobs raster_data;
+    raster_data.Atlas = atlas;
+    raster_data.SrcData = src_tmp_array.Data;
+    raster_data.PackContext = &spc;
+    raster_data.Jobs = raster_jobs.Data;
+    raster_data.Parallel = (parallel_for_fn != NULL && raster_jobs.Size > 1);
+    if (raster_data.Parallel)
+        parallel_for_fn(parallel_for_user_data, ImFontAtlasBuildRasterJobFunc, &raster_data, raster_jobs.Size);
+    else
+        for (int job_n = 0; job_n < raster_jobs.Size; job_n++)
+            ImFontAtlasBuildRasterJobFunc(&raster_data, job_n);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
+    ImVector<ImFontBuildDynamicRef> dynamic_refs;
+    dynamic_refs.reserve(dynamic_glyphs_count);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
+        if (src_tmp.GlyphsCount == 0 && src_tmp.GlyphsListDynamic.Size == 0)
             continue;
 
         ImFontConfig& cfg = atlas->ConfigData[src_i];
@@ -2117,6 +2785,19 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &dummy_x, &dummy_y, &q, 0);
             dst_font->AddGlyph((ImWchar)codepoint, q.x0 + char_off_x, q.y0 + font_off_y, q.x1 + char_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, char_advance_x_mod);
         }
+
+        // Register glyphs rasterized on demand with their final advance (same as stbtt_PackFontRangesRenderIntoRects) and an empty quad until first use
+        const float pack_scale = (cfg.SizePixels > 0) ? font_scale : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsListDynamic.Size; glyph_i++)
+        {
+            const int codepoint = src_tmp.GlyphsListDynamic[glyph_i];
+            int advance, lsb;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint), &advance, &lsb);
+            const float char_advance_x_mod = ImClamp(pack_scale * advance, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
+            ImFontBuildDynamicRef ref = { src_tmp.DstIndex, dst_font->Glyphs.Size, src_i };
+            dynamic_refs.push_back(ref);
+            dst_font->AddGlyph((ImWchar)codepoint, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, char_advance_x_mod);
+        }
     }
 
     // Cleanup temporary (ImVector doesn't honor destructor)
@@ -2124,6 +2805,8 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp_array[src_i].~ImFontBuildSrcData();
 
     ImFontAtlasBuildFinish(atlas);
+    if (dynamic_refs.Size > 0)
+        ImFontAtlasBuildDynamicInit(atlas, dynamic_refs, dynamic_cache_y);
     return true;
 }
 
@@ -2233,6 +2916,526 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
             atlas->Fonts[i]->BuildLookupTable();
 }
 
+//-----------------------------------------------------------------------------
+// Atlas cache (ImFontAtlas::CacheFilename)
+//-----------------------------------------------------------------------------
+// The cache file stores the output of ImFontAtlasBuildWithStbTruetype(): texture size and pixels, custom rectangles positions,
+// and for each font its metrics, glyphs and lookup tables. It starts with a key describing every input of the build (atlas settings,
+// font configurations with the size and hash of their data, glyph ranges, custom rectangles) which must match byte for byte,
+// followed by the size and hash of the payload to reject truncated or corrupted files. Values are stored in native byte order.
+// Payload: TexWidth, TexHeight, custom rectangles X/Y, fonts metrics and sizes (everything needed to compute the payload size
+// before touching the atlas), then for each font its glyphs, IndexAdvanceX[], IndexLookup[] and IndexPages[], then the Alpha8 pixels.
+//-----------------------------------------------------------------------------
+
+#define FONT_ATLAS_CACHE_VERSION        2
+#define FONT_ATLAS_CACHE_GLYPH_SIZE     (4 + 9 * 4) // Codepoint as 32-bit + AdvanceX, X0, Y0, X1, Y1, U0, V0, U1, V1 (ImFontGlyph has padding)
+static const char FONT_ATLAS_CACHE_MAGIC[8] = { 'I', 'm', 'F', 'A', 'C', 0, FONT_ATLAS_CACHE_VERSION, 0 };
+
+static void ImFontAtlasCacheWrite(ImVector<char>* buf, const void* data, size_t size)
+{
+    const int pos = buf->Size;
+    buf->resize(pos + (int)size);
+    memcpy(buf->Data + pos, data, size);
+}
+
+static const char* ImFontAtlasCacheRead(const char* p, void* data, size_t size)
+{
+    memcpy(data, p, size);
+    return p + size;
+}
+
+static int ImFontAtlasFindFontIndex(const ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+        if (atlas->Fonts[font_i] == font)
+            return font_i;
+    return -1;
+}
+
+// Every input of ImFontAtlasBuildWithStbTruetype(). Hashing the font data is the only cost which scales with the fonts size.
+static void ImFontAtlasBuildCacheKey(ImFontAtlas* atlas, ImVector<char>* out_key)
+{
+    const int header[] = { FONT_ATLAS_CACHE_VERSION, (int)sizeof(ImWchar), atlas->Flags, atlas->TexDesiredWidth, atlas->TexGlyphPadding, atlas->ConfigData.Size, atlas->Fonts.Size, atlas->CustomRects.Size };
+    ImFontAtlasCacheWrite(out_key, header, sizeof(header));
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+        ImFontAtlasCacheWrite(out_key, &atlas->Fonts[font_i]->FallbackChar, sizeof(ImWchar));
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_size = 0;
+        while (ranges[ranges_size] != 0)
+            ranges_size++;
+        const int ints[] = { ImFontAtlasFindFontIndex(atlas, cfg.DstFont), cfg.FontDataSize, (int)ImHashData(cfg.FontData, (size_t)cfg.FontDataSize), cfg.FontNo, cfg.OversampleH, cfg.OversampleV, cfg.PixelSnapH, cfg.MergeMode, (int)cfg.RasterizerFlags, ranges_size };
+        const float floats[] = { cfg.SizePixels, cfg.GlyphExtraSpacing.x, cfg.GlyphExtraSpacing.y, cfg.GlyphOffset.x, cfg.GlyphOffset.y, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX, cfg.RasterizerMultiply };
+        ImFontAtlasCacheWrite(out_key, ints, sizeof(ints));
+        ImFontAtlasCacheWrite(out_key, floats, sizeof(floats));
+        ImFontAtlasCacheWrite(out_key, ranges, sizeof(ImWchar) * ranges_size);
+    }
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        const ImFontAtlas::CustomRect& r = atlas->CustomRects[rect_i];
+        const int ints[] = { (int)r.ID, r.Width, r.Height, ImFontAtlasFindFontIndex(atlas, r.Font) };
+        const float floats[] = { r.GlyphAdvanceX, r.GlyphOffset.x, r.GlyphOffset.y };
+        ImFontAtlasCacheWrite(out_key, ints, sizeof(ints));
+        ImFontAtlasCacheWrite(out_key, floats, sizeof(floats));
+    }
+}
+
+bool ImFontAtlasBuildSaveCache(ImFontAtlas* atlas, const char* filename)
+{
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL && atlas->DynamicData == NULL);
+    ImVector<char> key, payload;
+    ImFontAtlasBuildCacheKey(atlas, &key);
+
+    const int tex_size[] = { atlas->TexWidth, atlas->TexHeight };
+    ImFontAtlasCacheWrite(&payload, tex_size, sizeof(tex_size));
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        const unsigned short pos[] = { atlas->CustomRects[rect_i].X, atlas->CustomRects[rect_i].Y };
+        ImFontAtlasCacheWrite(&payload, pos, sizeof(pos));
+    }
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        const ImFont* font = atlas->Fonts[font_i];
+        const float metrics[] = { font->Ascent, font->Descent };
+        const int sizes[] = { font->MetricsTotalSurface, font->Glyphs.Size, font->IndexLookup.Size, font->IndexPages.Size };
+        ImFontAtlasCacheWrite(&payload, metrics, sizeof(metrics));
+        ImFontAtlasCacheWrite(&payload, sizes, sizeof(sizes));
+    }
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        const ImFont* font = atlas->Fonts[font_i];
+        for (int glyph_i = 0; glyph_i < font->Glyphs.Size; glyph_i++)
+        {
+            const ImFontGlyph& glyph = font->Glyphs[glyph_i];
+            const ImU32 codepoint = glyph.Codepoint;
+            ImFontAtlasCacheWrite(&payload, &codepoint, sizeof(codepoint));
+            ImFontAtlasCacheWrite(&payload, &glyph.AdvanceX, sizeof(float) * 9);
+        }
+        ImFontAtlasCacheWrite(&payload, font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes());
+        ImFontAtlasCacheWrite(&payload, font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes());
+        ImFontAtlasCacheWrite(&payload, font->IndexPages.Data, (size_t)font->IndexPages.size_in_bytes());
+    }
+    ImFontAtlasCacheWrite(&payload, atlas->TexPixelsAlpha8, (size_t)(atlas->TexWidth * atlas->TexHeight));
+
+    FILE* f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const ImU32 key_size = (ImU32)key.Size;
+    const ImU32 payload_header[] = { (ImU32)payload.Size, ImHashData(payload.Data, (size_t)payload.Size) };
+    bool ret = fwrite(FONT_ATLAS_CACHE_MAGIC, sizeof(FONT_ATLAS_CACHE_MAGIC), 1, f) == 1;
+    ret &= fwrite(&key_size, sizeof(key_size), 1, f) == 1;
+    ret &= fwrite(key.Data, (size_t)key.Size, 1, f) == 1;
+    ret &= fwrite(payload_header, sizeof(payload_header), 1, f) == 1;
+    ret &= fwrite(payload.Data, (size_t)payload.Size, 1, f) == 1;
+    ret &= fclose(f) == 0;
+    return ret;
+}
+
+static bool ImFontAtlasBuildLoadCacheData(ImFontAtlas* atlas, const char* data, size_t data_size)
+{
+    // Validate header and key
+    ImU32 key_size = 0;
+    if (data_size < sizeof(FONT_ATLAS_CACHE_MAGIC) + sizeof(key_size) || memcmp(data, FONT_ATLAS_CACHE_MAGIC, sizeof(FONT_ATLAS_CACHE_MAGIC)) != 0)
+        return false;
+    const char* p = ImFontAtlasCacheRead(data + sizeof(FONT_ATLAS_CACHE_MAGIC), &key_size, sizeof(key_size));
+    ImVector<char> key;
+    ImFontAtlasBuildCacheKey(atlas, &key);
+    if (key_size != (ImU32)key.Size || (size_t)(data + data_size - p) < key_size + sizeof(ImU32) * 2 || memcmp(p, key.Data, key.Size) != 0)
+        return false;
+    ImU32 payload_header[2];
+    p = ImFontAtlasCacheRead(p + key_size, payload_header, sizeof(payload_header));
+    if ((size_t)(data + data_size - p) != payload_header[0] || ImHashData(p, payload_header[0]) != payload_header[1])
+        return false;
+
+    // Validate payload size from the sizes stored at its beginning
+    const char* p_sizes = p;
+    size_t sizes_size = sizeof(int) * 2 + sizeof(unsigned short) * 2 * atlas->CustomRects.Size + (sizeof(float) * 2 + sizeof(int) * 4) * atlas->Fonts.Size;
+    if (payload_header[0] < sizes_size)
+        return false;
+    int tex_size[2];
+    p = ImFontAtlasCacheRead(p, tex_size, sizeof(tex_size));
+    if (tex_size[0] <= 0 || tex_size[1] <= 0 || tex_size[0] > 0x8000 || tex_size[1] > 0x8000)
+        return false;
+    size_t expected_size = sizes_size + (size_t)tex_size[0] * (size_t)tex_size[1];
+    p += sizeof(unsigned short) * 2 * atlas->CustomRects.Size;
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        int sizes[4];
+        p = ImFontAtlasCacheRead(p + sizeof(float) * 2, sizes, sizeof(sizes));
+        if (sizes[1] < 0 || sizes[1] >= 0xFFFF || sizes[2] < 0 || sizes[2] > 0x100 * 0x102 || sizes[3] < 0 || sizes[3] > 0x100)
+            return false;
+        expected_size += (size_t)sizes[1] * FONT_ATLAS_CACHE_GLYPH_SIZE + (size_t)sizes[2] * (sizeof(float) + sizeof(ImWchar)) + (size_t)sizes[3] * sizeof(ImU16);
+    }
+    if (payload_header[0] != expected_size)
+        return false;
+
+    // Setup atlas (same as ImFontAtlasBuildWithStbTruetype)
+    atlas->TexID = (ImTextureID)NULL;
+    atlas->ClearTexData();
+    atlas->TexWidth = tex_size[0];
+    atlas->TexHeight = tex_size[1];
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    p = p_sizes + sizeof(int) * 2;
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        p = ImFontAtlasCacheRead(p, &atlas->CustomRects[rect_i].X, sizeof(unsigned short));
+        p = ImFontAtlasCacheRead(p, &atlas->CustomRects[rect_i].Y, sizeof(unsigned short));
+    }
+    const char* p_fonts = p;
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        ImFontConfig& cfg = atlas->ConfigData[src_i];
+        float metrics[2];
+        ImFontAtlasCacheRead(p_fonts + (sizeof(float) * 2 + sizeof(int) * 4) * ImFontAtlasFindFontIndex(atlas, cfg.DstFont), metrics, sizeof(metrics));
+        ImFontAtlasBuildSetupFont(atlas, cfg.DstFont, &cfg, metrics[0], metrics[1]);
+    }
+
+    // Setup fonts glyphs and lookup tables (same as ImFont::BuildLookupTable)
+    const char* p_font_data = p_fonts + (sizeof(float) * 2 + sizeof(int) * 4) * atlas->Fonts.Size;
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+    {
+        ImFont* font = atlas->Fonts[font_i];
+        int sizes[4];
+        p_fonts = ImFontAtlasCacheRead(p_fonts + sizeof(float) * 2, sizes, sizeof(sizes));
+        font->MetricsTotalSurface = sizes[0];
+        font->Glyphs.resize(sizes[1]);
+        for (int glyph_i = 0; glyph_i < sizes[1]; glyph_i++)
+        {
+            ImU32 codepoint;
+            p_font_data = ImFontAtlasCacheRead(p_font_data, &codepoint, sizeof(codepoint));
+            p_font_data = ImFontAtlasCacheRead(p_font_data, &font->Glyphs[glyph_i].AdvanceX, sizeof(float) * 9);
+            font->Glyphs[glyph_i].Codepoint = (ImWchar)codepoint;
+        }
+        font->IndexAdvanceX.resize(sizes[2]);
+        font->IndexLookup.resize(sizes[2]);
+        p_font_data = ImFontAtlasCacheRead(p_font_data, font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes());
+        p_font_data = ImFontAtlasCacheRead(p_font_data, font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes());
+        font->IndexPages.resize(sizes[3]);
+        p_font_data = ImFontAtlasCacheRead(p_font_data, font->IndexPages.Data, (size_t)font->IndexPages.size_in_bytes());
+        font->DirtyLookupTables = false;
+        font->FallbackGlyph = font->FindGlyphNoFallback(font->FallbackChar);
+        font->FallbackAdvanceX = font->FallbackGlyph ? font->FallbackGlyph->AdvanceX : 0.0f;
+    }
+
+    // Texture
+    const size_t tex_pixels_size = (size_t)(atlas->TexWidth * atlas->TexHeight);
+    atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_pixels_size);
+    memcpy(atlas->TexPixelsAlpha8, p_font_data, tex_pixels_size);
+    ImFontAtlasBuildRenderDefaultTexData(atlas);
+    return true;
+}
+
+bool ImFontAtlasBuildLoadCache(ImFontAtlas* atlas, const char* filename)
+{
+    IM_ASSERT(atlas->ConfigData.Size > 0);
+    ImFontAtlasBuildRegisterDefaultCustomRects(atlas);
+
+    size_t data_size = 0;
+    char* data = (char*)ImFileLoadToMemory(filename, "rb", &data_size);
+    if (!data)
+        return false;
+    const bool ret = ImFontAtlasBuildLoadCacheData(atlas, data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+//-----------------------------------------------------------------------------
+// Build() registers every requested glyph with its advance, but only packs ASCII and the fallback glyph.
+// The area of the texture below them is a cache split into pages: horizontal shelves whose height is a multiple of 8 pixels,
+// filled from left to right with glyphs of the matching height class, any font. ImFont::FindGlyph() rasterizes a glyph into a page
+// with enough room left, a new page, or the least recently used page, whose glyphs are all evicted (LRU at page granularity keeps
+// eviction O(pages) and free of fragmentation). Glyphs used during the current frame are never evicted, as vertices referring
+// to them have already been emitted: when every page is in use the glyph is left blank and DynamicGlyphsOverflowCount is incremented.
+// Everything is stored in a single allocation made by Build(), rasterizing doesn't allocate besides stb_truetype's temporary buffers.
+//-----------------------------------------------------------------------------
+
+struct ImFontDynamicSrc
+{
+    stbtt_fontinfo      FontInfo;
+    float               Scale;              // Same scale as used by stbtt_PackFontRangesRenderIntoRects()
+    float               FontOffY;           // Same offset as applied to glyphs packed by Build()
+    unsigned char       MultiplyTable[256]; // For ImFontConfig::RasterizerMultiply
+};
+
+struct ImFontDynamicGlyph
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[], -1 for glyphs packed by Build()
+    int                 PageIndex;          // Index into Pages[], -1 when not resident
+    int                 NextInPage;         // Index into Glyphs[] of the next glyph of the same page, -1 for the last one
+};
+
+struct ImFontDynamicPage
+{
+    int                 Y, H;
+    int                 ClassH;             // Height class of the glyphs stored in this page (<= H when reusing a page from another class)
+    int                 CursorX;            // Left of the unused part of the page
+    int                 FirstGlyph;         // Index into Glyphs[], -1 when empty
+    int                 LastUsedFrame;      // Last value of atlas->DynamicFrameCount any of its glyphs was looked up
+};
+
+struct ImFontAtlasDynamicData
+{
+    stbtt_pack_context  PackContext;        // Only the fields used by stbtt_PackFontRangesRenderIntoRects() are setup
+    ImFontDynamicSrc*   Srcs;               // [atlas->ConfigData.Size]
+    ImFontDynamicGlyph* Glyphs;             // Glyphs of all fonts, glyphs of atlas->Fonts[n] start at FontsGlyphsOffset[n]
+    ImFontDynamicPage*  Pages;              // [PagesMax]
+    int*                FontsGlyphsOffset;  // [atlas->Fonts.Size + 1]
+    int                 FontsCount;
+    int                 PagesCount;
+    int                 PagesMax;
+    int                 CacheY, CacheH;     // Cache area in the texture
+    int                 CacheNextY;         // Top of the unused part of the cache area
+};
+
+static const int FONT_ATLAS_DYNAMIC_PAGE_ROUNDING = 8;
+
+static void ImFontAtlasBuildDynamicInit(ImFontAtlas* atlas, const ImVector<ImFontBuildDynamicRef>& refs, int cache_y)
+{
+    IM_ASSERT(atlas->DynamicData == NULL && atlas->TexPixelsAlpha8 != NULL);
+    int glyphs_count = 0;
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+        glyphs_count += atlas->Fonts[font_i]->Glyphs.Size;
+    const int cache_h = atlas->TexHeight - cache_y;
+    const int pages_max = cache_h / FONT_ATLAS_DYNAMIC_PAGE_ROUNDING;
+
+    // Single allocation, arrays ordered by decreasing alignment
+    const size_t sz_header = sizeof(ImFontAtlasDynamicData);
+    const size_t sz_srcs = sizeof(ImFontDynamicSrc) * (size_t)atlas->ConfigData.Size;
+    const size_t sz_glyphs = sizeof(ImFontDynamicGlyph) * (size_t)glyphs_count;
+    const size_t sz_pages = sizeof(ImFontDynamicPage) * (size_t)pages_max;
+    const size_t sz_offsets = sizeof(int) * (size_t)(atlas->Fonts.Size + 1);
+    char* p = (char*)IM_ALLOC(sz_header + sz_srcs + sz_glyphs + sz_pages + sz_offsets);
+    ImFontAtlasDynamicData* d = (ImFontAtlasDynamicData*)(void*)p;
+    memset(d, 0, sz_header);
+    d->Srcs = (ImFontDynamicSrc*)(void*)(p += sz_header);
+    d->Glyphs = (ImFontDynamicGlyph*)(void*)(p += sz_srcs);
+    d->Pages = (ImFontDynamicPage*)(void*)(p += sz_glyphs);
+    d->FontsGlyphsOffset = (int*)(void*)(p += sz_pages);
+    d->FontsCount = atlas->Fonts.Size;
+    d->PagesMax = pages_max;
+    d->CacheY = d->CacheNextY = cache_y;
+    d->CacheH = cache_h;
+
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        ImFontDynamicSrc& src = d->Srcs[src_i];
+        memset(&src, 0, sizeof(src));
+        stbtt_InitFont(&src.FontInfo, (unsigned char*)cfg.FontData, stbtt_GetFontOffsetForIndex((unsigned char*)cfg.FontData, cfg.FontNo)); // Already validated by Build()
+        src.Scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src.FontInfo, -cfg.SizePixels);
+        src.FontOffY = cfg.GlyphOffset.y + (float)(int)(cfg.DstFont->Ascent + 0.5f);
+        ImFontAtlasBuildMultiplyCalcLookupTable(src.MultiplyTable, cfg.RasterizerMultiply);
+    }
+    d->FontsGlyphsOffset[0] = 0;
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+        d->FontsGlyphsOffset[font_i + 1] = d->FontsGlyphsOffset[font_i] + atlas->Fonts[font_i]->Glyphs.Size;
+    for (int glyph_i = 0; glyph_i < glyphs_count; glyph_i++)
+        d->Glyphs[glyph_i].SrcIndex = d->Glyphs[glyph_i].PageIndex = d->Glyphs[glyph_i].NextInPage = -1;
+    for (int ref_i = 0; ref_i < refs.Size; ref_i++)
+    {
+        const ImFontBuildDynamicRef& ref = refs[ref_i];
+        d->Glyphs[d->FontsGlyphsOffset[ref.DstIndex] + ref.GlyphIndex].SrcIndex = ref.SrcIndex;
+        atlas->Fonts[ref.DstIndex]->DynamicIndex = ref.DstIndex;
+    }
+
+    stbtt_pack_context& spc = d->PackContext;
+    spc.pixels = atlas->TexPixelsAlpha8;
+    spc.width = atlas->TexWidth;
+    spc.height = atlas->TexHeight;
+    spc.stride_in_bytes = atlas->TexWidth;
+    spc.padding = atlas->TexGlyphPadding;
+    spc.h_oversample = spc.v_oversample = 1;
+
+    atlas->DynamicData = d;
+    atlas->ClearTexDirty();
+}
+
+static void ImFontAtlasBuildDynamicDestroy(ImFontAtlas* atlas)
+{
+    if (atlas->DynamicData == NULL)
+        return;
+    for (int font_i = 0; font_i < atlas->Fonts.Size; font_i++)
+        atlas->Fonts[font_i]->DynamicIndex = -1;
+    IM_FREE(atlas->DynamicData);
+    atlas->DynamicData = NULL;
+    atlas->ClearTexDirty();
+}
+
+// Glyphs of a page all start at page.Y, so a rectangle starting on the same row belongs to the same page and is merged with it
+static void ImFontAtlasDynamicAddDirtyRect(ImFontAtlas* atlas, int x0, int y0, int x1, int y1)
+{
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        ImFontAtlas::TexDirtyRect& rect = atlas->TexDirtyRects[n];
+        if (rect.Y0 != y0)
+            continue;
+        rect.X0 = ImMin(rect.X0, x0);
+        rect.X1 = ImMax(rect.X1, x1);
+        rect.Y1 = ImMax(rect.Y1, y1);
+        return;
+    }
+    ImFontAtlas::TexDirtyRect rect = { x0, y0, x1, y1 };
+    atlas->TexDirtyRects.push_back(rect);
+}
+
+// Evict all glyphs of a page, their quad is emptied until they are looked up again.
+// Pixels are left in place: nothing samples them anymore, and each new glyph clears its own rectangle before being rasterized.
+static void ImFontAtlasDynamicEvictPage(ImFontAtlas* atlas, ImFontAtlasDynamicData* d, int page_i)
+{
+    ImFontDynamicPage& page = d->Pages[page_i];
+    for (int entry_i = page.FirstGlyph; entry_i != -1; )
+    {
+        ImFontDynamicGlyph& entry = d->Glyphs[entry_i];
+        const int font_i = atlas->ConfigData[entry.SrcIndex].DstFont->DynamicIndex;
+        ImFontGlyph& glyph = atlas->Fonts[font_i]->Glyphs[entry_i - d->FontsGlyphsOffset[font_i]];
+        glyph.X0 = glyph.Y0 = glyph.X1 = glyph.Y1 = 0.0f;
+        glyph.U0 = glyph.V0 = glyph.U1 = glyph.V1 = 0.0f;
+        entry.PageIndex = -1;
+        entry_i = entry.NextInPage;
+        entry.NextInPage = -1;
+        atlas->DynamicGlyphsEvictedCount++;
+    }
+    page.FirstGlyph = -1;
+    page.CursorX = 0;
+}
+
+// Return a page with room for a w*h rectangle, or -1
+static int ImFontAtlasDynamicFindPage(ImFontAtlas* atlas, ImFontAtlasDynamicData* d, int w, int h)
+{
+    const int class_h = ImMax((h + FONT_ATLAS_DYNAMIC_PAGE_ROUNDING - 1) / FONT_ATLAS_DYNAMIC_PAGE_ROUNDING, 1) * FONT_ATLAS_DYNAMIC_PAGE_ROUNDING;
+    if (w > atlas->TexWidth)
+        return -1;
+
+    // Page of the same class with enough room left
+    for (int page_i = 0; page_i < d->PagesCount; page_i++)
+        if (d->Pages[page_i].ClassH == class_h && d->Pages[page_i].CursorX + w <= atlas->TexWidth)
+            return page_i;
+
+    // New page, or least recently used page at least as tall
+    int page_i = -1;
+    if (d->PagesCount < d->PagesMax && d->CacheNextY + class_h <= d->CacheY + d->CacheH)
+    {
+        page_i = d->PagesCount++;
+        d->Pages[page_i].Y = d->CacheNextY;
+        d->Pages[page_i].H = class_h;
+        d->CacheNextY += class_h;
+    }
+    else
+    {
+        for (int n = 0; n < d->PagesCount; n++)
+            if (d->Pages[n].H >= class_h && d->Pages[n].LastUsedFrame < atlas->DynamicFrameCount && (page_i == -1 || d->Pages[n].LastUsedFrame < d->Pages[page_i].LastUsedFrame))
+                page_i = n;
+        if (page_i == -1)
+            return -1;
+        ImFontAtlasDynamicEvictPage(atlas, d, page_i);
+    }
+    ImFontDynamicPage& page = d->Pages[page_i];
+    page.ClassH = class_h;
+    page.CursorX = 0;
+    page.FirstGlyph = -1;
+    page.LastUsedFrame = atlas->DynamicFrameCount;
+    return page_i;
+}
+
+// Called by ImFont::FindGlyphNoRasterize(). Glyphs packed by Build() are never evicted and their data never changes, so they may be read from any thread.
+static bool ImFontAtlasDynamicIsBuiltGlyph(const ImFontAtlas* atlas, int font_index, int glyph_index)
+{
+    const ImFontAtlasDynamicData* d = atlas->DynamicData;
+    if (d == NULL || font_index >= d->FontsCount || glyph_index >= d->FontsGlyphsOffset[font_index + 1] - d->FontsGlyphsOffset[font_index])
+        return true;
+    return d->Glyphs[d->FontsGlyphsOffset[font_index] + glyph_index].SrcIndex == -1;
+}
+
+// Called by ImFont::FindGlyph()
+static void ImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas, int font_index, int glyph_index)
+{
+    ImFontAtlasDynamicData* d = atlas->DynamicData;
+    if (d == NULL || font_index >= d->FontsCount || glyph_index >= d->FontsGlyphsOffset[font_index + 1] - d->FontsGlyphsOffset[font_index])
+        return;
+    const int entry_i = d->FontsGlyphsOffset[font_index] + glyph_index;
+    ImFontDynamicGlyph& entry = d->Glyphs[entry_i];
+    if (entry.SrcIndex == -1)
+        return;
+    if (entry.PageIndex != -1)
+    {
+        d->Pages[entry.PageIndex].LastUsedFrame = atlas->DynamicFrameCount;
+        return;
+    }
+
+    // Measure (same as step 4 of ImFontAtlasBuildWithStbTruetype)
+    const ImFontConfig& cfg = atlas->ConfigData[entry.SrcIndex];
+    ImFontDynamicSrc& src = d->Srcs[entry.SrcIndex];
+    ImFontGlyph& glyph = atlas->Fonts[font_index]->Glyphs[glyph_index];
+    int codepoint = (int)glyph.Codepoint;
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(&src.FontInfo, stbtt_FindGlyphIndex(&src.FontInfo, codepoint), src.Scale * cfg.OversampleH, src.Scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect r;
+    memset(&r, 0, sizeof(r));
+    r.w = (stbrp_coord)(x1 - x0 + atlas->TexGlyphPadding + cfg.OversampleH - 1);
+    r.h = (stbrp_coord)(y1 - y0 + atlas->TexGlyphPadding + cfg.OversampleV - 1);
+    const int page_i = ImFontAtlasDynamicFindPage(atlas, d, r.w, r.h);
+    if (page_i == -1)
+    {
+        atlas->DynamicGlyphsOverflowCount++;
+        return;
+    }
+
+    // Rasterize (same as step 8)
+    ImFontDynamicPage& page = d->Pages[page_i];
+    r.x = (stbrp_coord)page.CursorX;
+    r.y = (stbrp_coord)page.Y;
+    r.was_packed = 1;
+    page.CursorX += r.w;
+    ImFontAtlasDynamicAddDirtyRect(atlas, r.x, r.y, r.x + r.w, r.y + r.h);
+    for (int y = r.y; y < r.y + r.h; y++)
+        memset(atlas->TexPixelsAlpha8 + r.x + y * atlas->TexWidth, 0, (size_t)r.w);
+    stbtt_packedchar pc;
+    memset(&pc, 0, sizeof(pc));
+    stbtt_pack_range range;
+    memset(&range, 0, sizeof(range));
+    range.font_size = cfg.SizePixels;
+    range.array_of_unicode_codepoints = &codepoint;
+    range.num_chars = 1;
+    range.chardata_for_range = &pc;
+    range.h_oversample = (unsigned char)cfg.OversampleH;
+    range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbtt_PackFontRangesRenderIntoRects(&d->PackContext, &src.FontInfo, &range, 1, &r);
+    if (cfg.RasterizerMultiply != 1.0f)
+        ImFontAtlasBuildMultiplyRectAlpha8(src.MultiplyTable, atlas->TexPixelsAlpha8, r.x, r.y, r.w, r.h, atlas->TexWidth * 1);
+    if (atlas->TexPixelsRGBA32)
+        for (int y = r.y; y < r.y + r.h; y++)
+            for (int x = r.x; x < r.x + r.w; x++)
+                atlas->TexPixelsRGBA32[x + y * atlas->TexWidth] = IM_COL32(255, 255, 255, (unsigned int)atlas->TexPixelsAlpha8[x + y * atlas->TexWidth]);
+
+    // Setup glyph (same as step 9). AdvanceX was already setup by Build().
+    const float char_advance_x_org = pc.xadvance;
+    const float char_advance_x_mod = ImClamp(char_advance_x_org, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
+    float char_off_x = cfg.GlyphOffset.x;
+    if (char_advance_x_org != char_advance_x_mod)
+        char_off_x += cfg.PixelSnapH ? (float)(int)((char_advance_x_mod - char_advance_x_org) * 0.5f) : (char_advance_x_mod - char_advance_x_org) * 0.5f;
+    stbtt_aligned_quad q;
+    float dummy_x = 0.0f, dummy_y = 0.0f;
+    stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &dummy_x, &dummy_y, &q, 0);
+    glyph.X0 = q.x0 + char_off_x;
+    glyph.Y0 = q.y0 + src.FontOffY;
+    glyph.X1 = q.x1 + char_off_x;
+    glyph.Y1 = q.y1 + src.FontOffY;
+    glyph.U0 = q.s0;
+    glyph.V0 = q.t0;
+    glyph.U1 = q.s1;
+    glyph.V1 = q.t1;
+
+    entry.PageIndex = page_i;
+    entry.NextInPage = page.FirstGlyph;
+    page.FirstGlyph = entry_i;
+    page.LastUsedFrame = atlas->DynamicFrameCount;
+    atlas->DynamicGlyphsRasterizedCount++;
+}
+
 // Retrieve list of range (2 int per range, values are inclusive)
 const ImWchar*   ImFontAtlas::GetGlyphRangesDefault()
 {
@@ -2506,6 +3709,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    DynamicIndex = -1;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -2523,13 +3727,28 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
+    DynamicIndex = -1;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
 }
 
+// Give its own page to a block of 256 code-points, initialized from the empty page
+static void ImFontAddIndexPage(ImFont* font, int page_n)
+{
+    IM_ASSERT(page_n > 0 && page_n < font->IndexPages.Size);
+    const int offset = font->IndexAdvanceX.Size;
+    IM_ASSERT((offset >> 8) <= 0xFFFF);
+    font->IndexPages[page_n] = (ImU16)(offset >> 8);
+    font->IndexAdvanceX.resize(offset + 0x100);
+    font->IndexLookup.resize(offset + 0x100);
+    memcpy(font->IndexAdvanceX.Data + offset, font->IndexAdvanceX.Data + 0x100, 0x100 * sizeof(float));
+    memcpy(font->IndexLookup.Data + offset, font->IndexLookup.Data + 0x100, 0x100 * sizeof(ImWchar));
+}
+
 void ImFont::BuildLookupTable()
 {
     int max_codepoint = 0;
@@ -2539,13 +3758,22 @@ void ImFont::BuildLookupTable()
     IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
     DirtyLookupTables = false;
     GrowIndex(max_codepoint + 1);
+
+    // Allocate pages in code-point order (see GetIndexOffset()), blocks with glyphs are marked with 0 first
+    for (int i = 0; i < Glyphs.Size; i++)
+        if (Glyphs[i].Codepoint >= 0x100)
+            IndexPages[Glyphs[i].Codepoint >> 8] = 0;
+    for (int page_n = 1; page_n < IndexPages.Size; page_n++)
+        if (IndexPages[page_n] == 0)
+            ImFontAddIndexPage(this, page_n);
     for (int i = 0; i < Glyphs.Size; i++)
     {
-        int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
+        const int offset = GetIndexOffset(Glyphs[i].Codepoint);
+        IndexAdvanceX[offset] = Glyphs[i].AdvanceX;
+        IndexLookup[offset] = (ImWchar)i;
     }
 
     // Create a glyph to handle TAB
@@ -2564,7 +3792,7 @@ void ImFont::BuildLookupTable()
 
     FallbackGlyph = FindGlyphNoFallback(FallbackChar);
     FallbackAdvanceX = FallbackGlyph ? FallbackGlyph->AdvanceX : 0.0f;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
 }
@@ -2575,13 +3803,17 @@ void ImFont::SetFallbackChar(ImWchar c)
     BuildLookupTable();
 }
 
+// Make code-points [0, new_size) indexable: blocks of 256 code-points without a page of their own use the empty page (see GetIndexOffset())
 void ImFont::GrowIndex(int new_size)
 {
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
-    if (new_size <= IndexLookup.Size)
-        return;
-    IndexAdvanceX.resize(new_size, -1.0f);
-    IndexLookup.resize(new_size, (ImWchar)-1);
+    if (IndexLookup.Size == 0)
+    {
+        IndexAdvanceX.resize(0x100 * 2, -1.0f);
+        IndexLookup.resize(0x100 * 2, (ImWchar)-1);
+        IndexPages.resize(1, 0);
+    }
+    IndexPages.resize(ImMax(IndexPages.Size, (new_size + 0xFF) >> 8), 1);
 }
 
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
@@ -2612,33 +3844,56 @@ void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1,
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    int index_size = IndexLookup.Size;
+    int dst_offset = GetIndexOffset(dst);
+    const int src_offset = GetIndexOffset(src);
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst_offset >= 0 && IndexLookup.Data[dst_offset] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
         return;
-    if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
+    if (src_offset < 0 && dst_offset < 0) // both 'dst' and 'src' don't exist -> no-op
         return;
 
     GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    if (dst >= 0x100 && IndexPages[dst >> 8] == 1)
+        ImFontAddIndexPage(this, dst >> 8);
+    dst_offset = GetIndexOffset(dst);
+    IndexLookup[dst_offset] = (src_offset >= 0) ? IndexLookup.Data[src_offset] : (ImWchar)-1;
+    IndexAdvanceX[dst_offset] = (src_offset >= 0) ? IndexAdvanceX.Data[src_offset] : 1.0f;
 }
 
+// With ImFontAtlasFlags_DynamicGlyphs, this rasterizes the glyph into the atlas on first use. Use FindGlyphNoFallback() to only query its existence.
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= IndexLookup.Size)
+    const int offset = GetIndexOffset(c);
+    if (offset < 0)
         return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[offset];
     if (i == (ImWchar)-1)
         return FallbackGlyph;
+    if (DynamicIndex != -1)
+        ImFontAtlasBuildDynamicGlyph(ContainerAtlas, DynamicIndex, (int)i);
+    return &Glyphs.Data[i];
+}
+
+// With ImFontAtlasFlags_DynamicGlyphs, glyphs rasterized on demand are replaced by the fallback glyph so the atlas is never modified (see ImDrawListFlags_NoRasterizeGlyphs)
+const ImFontGlyph* ImFont::FindGlyphNoRasterize(ImWchar c) const
+{
+    const int offset = GetIndexOffset(c);
+    if (offset < 0)
+        return FallbackGlyph;
+    const ImWchar i = IndexLookup.Data[offset];
+    if (i == (ImWchar)-1)
+        return FallbackGlyph;
+    if (DynamicIndex != -1 && !ImFontAtlasDynamicIsBuiltGlyph(ContainerAtlas, DynamicIndex, (int)i))
+        return FallbackGlyph;
     return &Glyphs.Data[i];
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= IndexLookup.Size)
+    const int offset = GetIndexOffset(c);
+    if (offset < 0)
         return NULL;
-    const ImWchar i = IndexLookup.Data[c];
+    const ImWchar i = IndexLookup.Data[offset];
     if (i == (ImWchar)-1)
         return NULL;
     return &Glyphs.Data[i];
@@ -2698,7 +3953,8 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        const int char_offset = GetIndexOffset(c);
+        const float char_width = (char_offset >= 0 ? IndexAdvanceX.Data[char_offset] : FallbackAdvanceX);
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -2743,6 +3999,25 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+// Printable ASCII characters (0x20..0x7F) don't need UTF-8 decoding, and are always found in the first page of IndexAdvanceX[]/IndexLookup[] (see GetIndexOffset())
+static inline bool ImCharIsPrintableAscii(char c) { return (unsigned char)c >= 0x20 && (unsigned char)c < 0x80; }
+
+// Sum the advances of a run of printable ASCII characters, stopping at the first one which would reach max_width. Return the end of the run.
+// Run loops are kept out of line: inlined, their state added spills around ImTextCharFromUtf8() and slowed down non-ASCII text.
+static IM_NOINLINE const char* ImFontCalcTextSizeAsciiRun(const float* advance_x, float scale, float max_width, float* line_width, const char* s, const char* s_end)
+{
+    float w = *line_width;
+    for (; s < s_end && ImCharIsPrintableAscii(*s); s++)
+    {
+        const float char_width = advance_x[(unsigned char)*s] * scale;
+        if (w + char_width >= max_width)
+            break;
+        w += char_width;
+    }
+    *line_width = w;
+    return s;
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
 {
     if (!text_end)
@@ -2788,6 +4063,22 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             }
         }
 
+        // Fast path for runs of printable ASCII characters, same computations as below.
+        // Single characters (e.g. spaces between words of non-ASCII text) are cheaper to process below than to call for.
+        if (ImCharIsPrintableAscii(*s) && IndexPages.Size > 0) // Page 0 is at offset 0
+        {
+            const char* run_end = word_wrap_enabled ? word_wrap_eol : text_end;
+            if (s + 1 < run_end && ImCharIsPrintableAscii(s[1]))
+            {
+                float run_line_width = line_width; // Not passing &line_width, which would keep it in memory for the whole loop
+                s = ImFontCalcTextSizeAsciiRun(IndexAdvanceX.Data, scale, max_width, &run_line_width, s, run_end);
+                line_width = run_line_width;
+                if (s < run_end && ImCharIsPrintableAscii(*s)) // Stopped by max_width
+                    break;
+                continue;
+            }
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -2815,7 +4106,8 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        const int char_offset = GetIndexOffset(c);
+        const float char_width = (char_offset >= 0 ? IndexAdvanceX.Data[char_offset] : FallbackAdvanceX) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -2841,7 +4133,7 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
 {
     if (c == ' ' || c == '\t' || c == '\n' || c == '\r') // Match behavior of RenderText(), those 4 codepoints are hard-coded.
         return;
-    if (const ImFontGlyph* glyph = FindGlyph(c))
+    if (const ImFontGlyph* glyph = (draw_list->Flags & ImDrawListFlags_NoRasterizeGlyphs) ? FindGlyphNoRasterize(c) : FindGlyph(c))
     {
         float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
         pos.x = (float)(int)pos.x + DisplayOffset.x;
@@ -2851,6 +4143,122 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     }
 }
 
+// Write the indices of 'quad_count' quads made of consecutive vertices starting at 'vtx_idx', in the same order as PrimRectUV()
+static ImDrawIdx* ImDrawIdxWriteQuads(ImDrawIdx* idx_write, unsigned int vtx_idx, int quad_count)
+{
+    int n = 0;
+#ifdef IMGUI_ENABLE_SSE
+    if (sizeof(ImDrawIdx) == 2)
+    {
+        // 4 quads = 24 indices = 3 registers
+        const __m128i base = _mm_set1_epi16((short)vtx_idx);
+        const __m128i step = _mm_set1_epi16(16);
+        __m128i i0 = _mm_add_epi16(_mm_setr_epi16(0, 1, 2, 0, 2, 3, 4, 5), base);
+        __m128i i1 = _mm_add_epi16(_mm_setr_epi16(6, 4, 6, 7, 8, 9, 10, 8), base);
+        __m128i i2 = _mm_add_epi16(_mm_setr_epi16(10, 11, 12, 13, 14, 12, 14, 15), base);
+        for (; n + 4 <= quad_count; n += 4, idx_write += 24)
+        {
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 0), i0);
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 8), i1);
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 16), i2);
+            i0 = _mm_add_epi16(i0, step);
+            i1 = _mm_add_epi16(i1, step);
+            i2 = _mm_add_epi16(i2, step);
+        }
+    }
+    else if (sizeof(ImDrawIdx) == 4)
+    {
+        // 2 quads = 12 indices = 3 registers
+        const __m128i base = _mm_set1_epi32((int)vtx_idx);
+        const __m128i step = _mm_set1_epi32(8);
+        __m128i i0 = _mm_add_epi32(_mm_setr_epi32(0, 1, 2, 0), base);
+        __m128i i1 = _mm_add_epi32(_mm_setr_epi32(2, 3, 4, 5), base);
+        __m128i i2 = _mm_add_epi32(_mm_setr_epi32(6, 4, 6, 7), base);
+        for (; n + 2 <= quad_count; n += 2, idx_write += 12)
+        {
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 0), i0);
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 4), i1);
+            _mm_storeu_si128((__m128i*)(void*)(idx_write + 8), i2);
+            i0 = _mm_add_epi32(i0, step);
+            i1 = _mm_add_epi32(i1, step);
+            i2 = _mm_add_epi32(i2, step);
+        }
+    }
+    vtx_idx += (unsigned int)n * 4;
+#endif
+    for (; n < quad_count; n++, vtx_idx += 4, idx_write += 6)
+    {
+        idx_write[0] = (ImDrawIdx)(vtx_idx); idx_write[1] = (ImDrawIdx)(vtx_idx+1); idx_write[2] = (ImDrawIdx)(vtx_idx+2);
+        idx_write[3] = (ImDrawIdx)(vtx_idx); idx_write[4] = (ImDrawIdx)(vtx_idx+2); idx_write[5] = (ImDrawIdx)(vtx_idx+3);
+    }
+    return idx_write;
+}
+
+// Render a run of printable ASCII characters, same computations as ImFont::RenderText() without CPU side clipping. Return the end of the run.
+// Vertices are written as glyphs are processed, then the indices of all the quads of the run at once.
+static IM_NOINLINE const char* ImFontRenderTextAsciiRun(const ImFont* font, float scale, float* x_io, float y, ImU32 col, const ImVec4& clip_rect, const char* s, const char* s_end, ImDrawVert** vtx_write_io, ImDrawIdx** idx_write_io, unsigned int* vtx_current_idx_io)
+{
+    float x = *x_io;
+    ImDrawVert* vtx_write = *vtx_write_io;
+    unsigned int vtx_current_idx = *vtx_current_idx_io;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_COMPACT_DRAWVERT) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+    const __m128 scale_v = _mm_set1_ps(scale);
+    const __m128 col_v = _mm_castsi128_ps(_mm_set1_epi32((int)col));
+#endif
+    const unsigned int run_vtx_idx = vtx_current_idx;
+    for (; s < s_end && ImCharIsPrintableAscii(*s); s++)
+    {
+        const unsigned int c = (unsigned char)*s;
+        const ImWchar glyph_idx = font->IndexLookup.Data[c];
+        const ImFontGlyph* glyph = (font->DynamicIndex != -1) ? font->FindGlyph((ImWchar)c) : (glyph_idx != (ImWchar)-1) ? &font->Glyphs.Data[glyph_idx] : font->FallbackGlyph; // ASCII glyphs are packed by Build(), FindGlyph() doesn't modify the atlas
+        float char_width = 0.0f;
+        if (glyph)
+        {
+            char_width = glyph->AdvanceX * scale;
+            if (c != ' ')
+            {
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_COMPACT_DRAWVERT) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+                // p = (x1, y1, x2, y2), uv = (u1, v1, u2, v2)
+                const __m128 p = _mm_add_ps(_mm_setr_ps(x, y, x, y), _mm_mul_ps(_mm_loadu_ps(&glyph->X0), scale_v));
+                if (_mm_cvtss_f32(p) <= clip_rect.z && _mm_cvtss_f32(_mm_movehl_ps(p, p)) >= clip_rect.x)
+                {
+                    // The 4 vertices are 5 registers: (x1, y1, u1, v1) (col, x2, y1, u2) (v1, col, x2, y2) (u2, v2, col, x1) (y2, u1, v2, col)
+                    const __m128 uv = _mm_loadu_ps(&glyph->U0);
+                    float* dst = (float*)(void*)vtx_write;
+                    _mm_storeu_ps(dst + 0, _mm_movelh_ps(p, uv));
+                    _mm_storeu_ps(dst + 4, _mm_shuffle_ps(_mm_shuffle_ps(col_v, p, _MM_SHUFFLE(2,2,0,0)), _mm_shuffle_ps(p, uv, _MM_SHUFFLE(2,2,1,1)), _MM_SHUFFLE(2,0,2,0)));
+                    _mm_storeu_ps(dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(uv, col_v, _MM_SHUFFLE(0,0,1,1)), p, _MM_SHUFFLE(3,2,2,0)));
+                    _mm_storeu_ps(dst + 12, _mm_shuffle_ps(uv, _mm_shuffle_ps(col_v, p, _MM_SHUFFLE(0,0,0,0)), _MM_SHUFFLE(2,0,3,2)));
+                    _mm_storeu_ps(dst + 16, _mm_shuffle_ps(_mm_shuffle_ps(p, uv, _MM_SHUFFLE(0,0,3,3)), _mm_shuffle_ps(uv, col_v, _MM_SHUFFLE(0,0,3,3)), _MM_SHUFFLE(2,0,2,0)));
+                    vtx_write += 4;
+                    vtx_current_idx += 4;
+                }
+#else
+                const float x1 = x + glyph->X0 * scale;
+                const float x2 = x + glyph->X1 * scale;
+                const float y1 = y + glyph->Y0 * scale;
+                const float y2 = y + glyph->Y1 * scale;
+                if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+                {
+                    vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = col; vtx_write[0].uv = ImVec2(glyph->U0, glyph->V0);
+                    vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = col; vtx_write[1].uv = ImVec2(glyph->U1, glyph->V0);
+                    vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = col; vtx_write[2].uv = ImVec2(glyph->U1, glyph->V1);
+                    vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = col; vtx_write[3].uv = ImVec2(glyph->U0, glyph->V1);
+                    vtx_write += 4;
+                    vtx_current_idx += 4;
+                }
+#endif
+            }
+        }
+        x += char_width;
+    }
+    *idx_write_io = ImDrawIdxWriteQuads(*idx_write_io, run_vtx_idx, (int)(vtx_current_idx - run_vtx_idx) / 4);
+    *x_io = x;
+    *vtx_write_io = vtx_write;
+    *vtx_current_idx_io = vtx_current_idx;
+    return s;
+}
+
 void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
 {
     if (!text_end)
@@ -2906,6 +4314,9 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
 
+    const bool ascii_fast_path = !cpu_fine_clip && IndexPages.Size > 0; // Page 0 is at offset 0
+    const bool no_rasterize_glyphs = (DynamicIndex != -1) && (draw_list->Flags & ImDrawListFlags_NoRasterizeGlyphs);
+
     while (s < text_end)
     {
         if (word_wrap_enabled)
@@ -2934,6 +4345,17 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
             }
         }
 
+        // Fast path for runs of printable ASCII characters, same computations as below without CPU side clipping (single characters are processed below)
+        if (ascii_fast_path && ImCharIsPrintableAscii(*s))
+        {
+            const char* run_end = word_wrap_enabled ? word_wrap_eol : text_end;
+            if (s + 1 < run_end && ImCharIsPrintableAscii(s[1]))
+            {
+                s = ImFontRenderTextAsciiRun(this, scale, &x, y, col, clip_rect, s, run_end, &vtx_write, &idx_write, &vtx_current_idx);
+                continue;
+            }
+        }
+
         // Decode and advance source
         unsigned int c = (unsigned int)*s;
         if (c < 0x80)
@@ -2962,7 +4384,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
         }
 
         float char_width = 0.0f;
-        if (const ImFontGlyph* glyph = FindGlyph((ImWchar)c))
+        if (const ImFontGlyph* glyph = no_rasterize_glyphs ? FindGlyphNoRasterize((ImWchar)c) : FindGlyph((ImWchar)c))
         {
             char_width = glyph->AdvanceX * scale;
 
@@ -3016,10 +4438,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                     {
                         idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                         idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                        vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = col; vtx_write[0].uv = ImVec2(u1, v1);
+                        vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = col; vtx_write[1].uv = ImVec2(u2, v1);
+                        vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = col; vtx_write[2].uv = ImVec2(u2, v2);
+                        vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = col; vtx_write[3].uv = ImVec2(u1, v2);
                         vtx_write += 4;
                         vtx_current_idx += 4;
                         idx_write += 6;
@@ -3137,7 +4559,7 @@ void ImFont::RenderTextVertical(ImDrawList* draw_list, float size, ImVec2 pos, I
         }
 
         float char_width = 0.0f;
-        if (const ImFont::Glyph* glyph = FindGlyph((unsigned short)c))
+        if (const ImFont::Glyph* glyph = (draw_list->Flags & ImDrawListFlags_NoRasterizeGlyphs) ? FindGlyphNoRasterize((unsigned short)c) : FindGlyph((unsigned short)c))
         {
             char_width = glyph->AdvanceX * scale;
 
@@ -3201,22 +4623,22 @@ void ImFont::RenderTextVertical(ImDrawList* draw_list, float size, ImVec2 pos, I
                         idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx + 1); idx_write[2] = (ImDrawIdx)(vtx_current_idx + 2);
                         idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx + 2); idx_write[5] = (ImDrawIdx)(vtx_current_idx + 3);
                         vtx_write[0].col = vtx_write[1].col = vtx_write[2].col = vtx_write[3].col = col;
-                        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1;
-                        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1;
-                        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2;
-                        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2;
+                        vtx_write[0].pos = ImVec2(x1, y1);
+                        vtx_write[1].pos = ImVec2(x2, y1);
+                        vtx_write[2].pos = ImVec2(x2, y2);
+                        vtx_write[3].pos = ImVec2(x1, y2);
 
                         if (rotateCCW) {
-                            vtx_write[0].uv.x = u2; vtx_write[0].uv.y = v1;
-                            vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v2;
-                            vtx_write[2].uv.x = u1; vtx_write[2].uv.y = v2;
-                            vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v1;
+                            vtx_write[0].uv = ImVec2(u2, v1);
+                            vtx_write[1].uv = ImVec2(u2, v2);
+                            vtx_write[2].uv = ImVec2(u1, v2);
+                            vtx_write[3].uv = ImVec2(u1, v1);
                         }
                         else {
-                            vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v2;
-                            vtx_write[1].uv.x = u1; vtx_write[1].uv.y = v1;
-                            vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v1;
-                            vtx_write[3].uv.x = u2; vtx_write[3].uv.y = v2;
+                            vtx_write[0].uv = ImVec2(u1, v2);
+                            vtx_write[1].uv = ImVec2(u1, v1);
+                            vtx_write[2].uv = ImVec2(u2, v1);
+                            vtx_write[3].uv = ImVec2(u2, v2);
                         }
 
                         vtx_write += 4;
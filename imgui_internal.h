@@ -36,6 +36,12 @@ Index of this file:
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
 
+// Enable SSE2 intrinsics if the target supports them
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_ENABLE_SSE
+#include <emmintrin.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -67,12 +73,16 @@ Index of this file:
 
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
+struct ImDrawTessellateJob;         // Range of deferred primitives of a draw list, tessellated by Render() (io.ConfigDeferTessellation)
+struct ImDrawFlattenList;           // Destination of a draw list in a flattened ImDrawData (ImDrawData::FlattenInto(), io.ConfigFlattenDrawData)
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImDrawRetainedPrim;          // Line, filled shape or text tessellated by a draw list using ImDrawListFlags_RetainTessellation
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColumnData;             // Storage data for a single column
 struct ImGuiColumns;                // Storage data for a columns set
 struct ImGuiContext;                // Main imgui context
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
+struct ImGuiDrawListAttachment;     // Draw list rendered after a window or the foreground draw list (AddDrawListToWindow(), AddDrawListToForeground())
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiItemHoveredDataBackup;  // Backup and restore IsItemHovered() internal data
@@ -81,6 +91,11 @@ struct ImGuiNavMoveResult;          // Result of a directional navigation move q
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiProfilerFrame;          // Storage for the scopes recorded during one frame by the profiler
+struct ImGuiProfilerScope;          // Storage for one timed scope recorded by the profiler
+struct ImGuiAllocAuditRecord;       // Storage for one heap allocation flagged by the allocation audit
+struct ImGuiMemoryAlloc;            // Storage for one heap allocation tracked by the memory accounting
+struct ImGuiMemoryTagStats;         // Storage for the live/peak heap bytes of one subsystem
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
@@ -95,6 +110,7 @@ typedef int ImGuiButtonFlags;           // -> enum ImGuiButtonFlags_        // F
 typedef int ImGuiDragFlags;             // -> enum ImGuiDragFlags_          // Flags: for DragBehavior()
 typedef int ImGuiItemFlags;             // -> enum ImGuiItemFlags_          // Flags: for PushItemFlag()
 typedef int ImGuiItemStatusFlags;       // -> enum ImGuiItemStatusFlags_    // Flags: for DC.LastItemStatusFlags
+typedef int ImGuiMemoryTag;             // -> enum ImGuiMemoryTag_          // Enum: Subsystem owning a heap allocation (memory accounting)
 typedef int ImGuiNavHighlightFlags;     // -> enum ImGuiNavHighlightFlags_  // Flags: for RenderNavHighlight()
 typedef int ImGuiNavDirSourceFlags;     // -> enum ImGuiNavDirSourceFlags_  // Flags: for GetNavInputAmount2d()
 typedef int ImGuiNavMoveFlags;          // -> enum ImGuiNavMoveFlags_       // Flags: for navigation requests
@@ -154,6 +170,15 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit ImGui context pointe
 #define IMGUI_CDECL
 #endif
 
+// Keep a function out of its callers, e.g. so the registers used by a fast path don't add spills to the generic loop it is called from
+#if defined(_MSC_VER)
+#define IM_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__) || defined(__clang__)
+#define IM_NOINLINE __attribute__((noinline))
+#else
+#define IM_NOINLINE
+#endif
+
 // Helpers: UTF-8 <> wchar
 IMGUI_API int           ImTextStrToUtf8(char* buf, int buf_size, const ImWchar* in_text, const ImWchar* in_text_end);      // return output UTF-8 bytes count
 IMGUI_API int           ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char* in_text_end);          // read one character. return input UTF-8 bytes count
@@ -167,6 +192,7 @@ IMGUI_API ImU32         ImHashData(const void* data, size_t data_size, ImU32 see
 IMGUI_API ImU32         ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
 IMGUI_API void*         ImFileLoadToMemory(const char* filename, const char* file_open_mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 IMGUI_API FILE*         ImFileOpen(const char* filename, const char* file_open_mode);
+IMGUI_API ImU64         ImGetTimeNs();  // Monotonic clock in nanoseconds, for statistics only
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
 static inline bool      ImIsPowerOfTwo(int v)           { return v != 0 && (v & (v - 1)) == 0; }
@@ -197,6 +223,7 @@ IMGUI_API const char*   ImStristr(const char* haystack, const char* haystack_end
 IMGUI_API void          ImStrTrimBlanks(char* str);
 IMGUI_API int           ImFormatString(char* buf, size_t buf_size, const char* fmt, ...) IM_FMTARGS(3);
 IMGUI_API int           ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args) IM_FMTLIST(3);
+IMGUI_API void          ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end, const char* fmt, va_list args) IM_FMTLIST(3); // Format into g.TempBuffer, or into g.FrameArena if it doesn't fit. Valid until the next NewFrame().
 IMGUI_API const char*   ImParseFormatFindStart(const char* format);
 IMGUI_API const char*   ImParseFormatFindEnd(const char* format);
 IMGUI_API const char*   ImParseFormatTrimDecorations(const char* format, char* buf, size_t buf_size);
@@ -303,6 +330,29 @@ struct IMGUI_API ImPool
     int         GetSize() const                     { return Data.Size; }
 };
 
+// Helper: ImArena. Bump allocator for transient data, everything is released at once by Reset().
+// Allocations which don't fit in the block are made with IM_ALLOC(), then Reset() grows the block to fit the usage it saw,
+// so an arena reset every frame stops touching the heap after the first frames. Not thread-safe.
+struct IMGUI_API ImArena
+{
+    char*           Block;
+    int             BlockSize;
+    int             BlockUsed;
+    ImVector<void*> OverflowAllocs;     // Allocations which didn't fit in the block, freed by Reset()
+    int             UsedBytes;          // Bytes allocated since the last Reset(), including overflow
+    int             AllocsCount;        // Allocations since the last Reset()
+    int             LastUsedBytes;      // Statistics: UsedBytes, AllocsCount and OverflowAllocs.Size at the time of the last Reset()
+    int             LastAllocsCount;
+    int             LastOverflowCount;
+    int             PeakUsedBytes;      // Statistics: highest UsedBytes at the time of a Reset()
+
+    ImArena()       { memset(this, 0, sizeof(*this)); }
+    ~ImArena()      { Clear(); }
+    void*           Alloc(size_t size);     // 16-bytes aligned
+    void            Reset();
+    void            Clear();                // Reset() and free all memory
+};
+
 //-----------------------------------------------------------------------------
 // Misc data structures
 //-----------------------------------------------------------------------------
@@ -431,6 +481,28 @@ enum ImGuiLogType
     ImGuiLogType_Clipboard
 };
 
+// Allocation audit mode, see g.AllocAuditMode
+enum ImGuiAllocAuditMode
+{
+    ImGuiAllocAuditMode_None = 0,
+    ImGuiAllocAuditMode_Record,             // Count and record heap allocations made after warm-up
+    ImGuiAllocAuditMode_Assert              // Same as _Record + assert on every heap allocation made after warm-up
+};
+
+// Subsystem owning a heap allocation, see g.MemoryTagsEnabled
+enum ImGuiMemoryTag_
+{
+    ImGuiMemoryTag_Other = 0,               // Not attributed: user allocations, transient buffers, subsystems not listed below
+    ImGuiMemoryTag_Windows,                 // ImGuiWindow, name, ID stack, layout stacks, windows lists
+    ImGuiMemoryTag_DrawLists,               // Draw lists buffers (windows, background/foreground, flattened), retained draw lists, draw data layers
+    ImGuiMemoryTag_FontAtlas,               // Fonts, glyphs, lookup tables, texture pixels, font data owned by the atlas
+    ImGuiMemoryTag_Storage,                 // ImGuiStorage of windows (e.g. tree nodes open state) and windows map
+    ImGuiMemoryTag_InputText,               // Buffers of the active text input
+    ImGuiMemoryTag_Settings,                // .ini settings entries, handlers and serialized data
+    ImGuiMemoryTag_Columns,                 // Columns storage of windows
+    ImGuiMemoryTag_COUNT
+};
+
 // X/Y enums are fixed to 0/1 so they may be used to index ImVec2
 enum ImGuiAxis
 {
@@ -651,8 +723,11 @@ struct ImGuiWindowSettings
     ImVec2      Pos;
     ImVec2      Size;
     bool        Collapsed;
+    bool        WantSerialize;  // Entry changed since it was last serialized to g.SettingsWindowsIniCache
+    int         IniCacheOffset; // Serialized entry in g.SettingsWindowsIniCache (valid when WantSerialize == false)
+    int         IniCacheSize;
 
-    ImGuiWindowSettings() { Name = NULL; ID = 0; Pos = Size = ImVec2(0,0); Collapsed = false; }
+    ImGuiWindowSettings() { Name = NULL; ID = 0; Pos = Size = ImVec2(0,0); Collapsed = false; WantSerialize = true; IniCacheOffset = IniCacheSize = 0; }
 };
 
 struct ImGuiSettingsHandler
@@ -662,6 +737,8 @@ struct ImGuiSettingsHandler
     void*       (*ReadOpenFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const char* name);              // Read: Called when entering into a new ini entry e.g. "[Window][Name]"
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const char* data, const char* data_end);  // Read binary (optional): Called with the contents written by WriteBinaryFn
+    void        (*WriteBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* out_buf);    // Write binary (optional): Append every entries into 'out_buf'. Handlers without binary functions are stored as text in the binary settings.
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
@@ -740,6 +817,48 @@ struct IMGUI_API ImDrawListSharedData
     ImDrawListSharedData();
 };
 
+// Line, filled shape or text tessellated by a draw list using ImDrawListFlags_RetainTessellation
+struct ImDrawRetainedPrim
+{
+    ImU64           Hash;                       // Hash of the parameters
+    int             VtxOffset;                  // Position of the output in VtxBuffer/IdxBuffer
+    int             IdxOffset;
+    unsigned int    VtxCurrentIdx;              // Value of ImDrawList::_VtxCurrentIdx before the primitive, which its indices are relative to
+    int             VtxCount;                   // Size of the output
+    int             IdxCount;
+};
+
+// Storage for a draw list using ImDrawListFlags_RetainTessellation (see ImGuiWindowFlags_RetainDrawList)
+// ImDrawList::Clear() doesn't free memory, so the output of the previous frame is still in the buffers past their new size. When a line, filled shape
+// or text is submitted with the same parameters at the same position as during the previous frame, its vertices and indices are reused in place.
+struct ImDrawListRetainedData
+{
+    ImVector<ImDrawRetainedPrim> PrevPrims;     // Primitives of the previous frame, in submission order (so by increasing VtxOffset)
+    ImVector<ImDrawRetainedPrim> Prims;         // Primitives of the current frame
+    int                 PrevPrimsIdx;           // Next candidate in PrevPrims
+    const ImDrawVert*   VtxData;                // Buffers holding the output of PrevPrims, nothing is reused once they are reallocated
+    const ImDrawIdx*    IdxData;
+    int                 VtxCapacity;            // Capacities only grow: also detect a reallocation which returned the same address
+    int                 IdxCapacity;
+    int                 ReusedCount;            // Statistics: primitives reused during the current frame
+    int                 TessellatedCount;       // Statistics: primitives tessellated during the current frame
+    int                 ReusedCountTotal;       // Statistics: totals for the Metrics window
+    int                 TessellatedCountTotal;
+
+    ImDrawListRetainedData() { PrevPrimsIdx = 0; VtxData = NULL; IdxData = NULL; VtxCapacity = IdxCapacity = 0; ReusedCount = TessellatedCount = ReusedCountTotal = TessellatedCountTotal = 0; }
+};
+
+// Draw list attached by AddDrawListToWindow()/AddDrawListToForeground(), with the clip rectangle and texture id current at that point.
+// They are applied to the commands of the draw list by Render(), so attaching doesn't modify the draw list.
+struct ImGuiDrawListAttachment
+{
+    ImDrawList*     DrawList;
+    ImVec4          ClipRect;
+    ImTextureID     TextureId;
+
+    ImGuiDrawListAttachment(ImDrawList* draw_list, const ImVec4& clip_rect, ImTextureID texture_id) { DrawList = draw_list; ClipRect = clip_rect; TextureId = texture_id; }
+};
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>   Layers[2];           // Global layers for: regular, tooltip
@@ -749,6 +868,22 @@ struct ImDrawDataBuilder
     IMGUI_API void FlattenIntoSingleLayer();
 };
 
+// Range of deferred primitives of a draw list, tessellated by Render() (io.ConfigDeferTessellation)
+struct ImDrawTessellateJob
+{
+    ImDrawList*             DrawList;
+    int                     PrimBegin;
+    int                     PrimEnd;
+};
+
+struct ImDrawFlattenList
+{
+    const ImDrawList*       Src;
+    int                     VtxDst;                 // Offset of the copied vertices in the output VtxBuffer
+    int                     IdxDst;                 // Offset of the copied indices in the output IdxBuffer
+    unsigned int            IdxRebase;              // Added to the copied indices (0: copied as-is)
+};
+
 struct ImGuiNavMoveResult
 {
     ImGuiID       ID;           // Best candidate
@@ -834,6 +969,50 @@ struct ImGuiTabBarRef
     ImGuiTabBarRef(int index_in_main_pool)  { Ptr = NULL; IndexInMainPool = index_in_main_pool; }
 };
 
+// Timed scope recorded by the profiler, see ProfilerBeginScope()
+struct ImGuiProfilerScope
+{
+    const char*     Name;                   // Must persist until the frame is overwritten in the ring buffer: string literal or window->Name
+    ImU64           StartNs;
+    ImU64           EndNs;                  // 0 while the scope is open
+    int             Depth;                  // Number of parent scopes
+};
+
+struct ImGuiProfilerFrame
+{
+    int                         FrameCount; // g.FrameCount of the recorded frame, -1 if unused
+    ImU64                       StartNs;
+    ImU64                       EndNs;      // End of the last closed top-level scope
+    ImVector<ImGuiProfilerScope> Scopes;    // In begin order (= depth-first order)
+
+    ImGuiProfilerFrame()        { FrameCount = -1; StartNs = EndNs = 0; }
+};
+
+// Heap allocation made after the allocation audit warm-up, see g.AllocAuditMode
+struct ImGuiAllocAuditRecord
+{
+    int                         FrameCount; // g.FrameCount when the allocation was made
+    size_t                      Size;
+    const char*                 Tag;        // Value of g.AllocAuditTag: "NewFrame", "EndFrame", "Render" or NULL when called from user code between NewFrame() and EndFrame()
+    const char*                 WindowName; // Name of g.CurrentWindow, NULL if none
+};
+
+// Heap allocation tracked by the memory accounting (entry of the g.MemoryAllocs hash table), see g.MemoryTagsEnabled
+struct ImGuiMemoryAlloc
+{
+    void*                       Ptr;        // NULL for empty slots
+    size_t                      Size;
+    ImGuiMemoryTag              Tag;
+};
+
+// Live and peak heap bytes of a subsystem, see g.MemoryTagsEnabled
+struct ImGuiMemoryTagStats
+{
+    size_t                      LiveBytes;
+    size_t                      PeakBytes;
+    int                         LiveCount;  // Number of live allocations
+};
+
 //-----------------------------------------------------------------------------
 // Main imgui context
 //-----------------------------------------------------------------------------
@@ -866,6 +1045,9 @@ struct ImGuiContext
     ImGuiWindow*            HoveredWindow;                      // Will catch mouse inputs
     ImGuiWindow*            HoveredRootWindow;                  // Will catch mouse inputs (for focus/move only)
     ImGuiWindow*            MovingWindow;                       // Track the window we clicked on (in order to preserve focus). The actually window that is moved is generally MovingWindow->RootWindow.
+    int                     WindowsMemoryUsage;                 // Statistics: bytes used by all windows, updated by NewFrame() (see io.ConfigWindowsMemoryCompactTimer)
+    int                     WindowsMemoryUsagePeak;             // Statistics: highest WindowsMemoryUsage so far
+    int                     WindowsMemoryCompactedCount;        // Statistics: number of windows with compacted buffers
 
     // Item/widgets state and tracking information
     ImGuiID                 HoveredId;                          // Hovered widget
@@ -961,6 +1143,7 @@ struct ImGuiContext
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
     ImDrawList              BackgroundDrawList;                 // First draw list to be rendered.
     ImDrawList              ForegroundDrawList;                 // Last draw list to be rendered. This is where we the render software mouse cursor (if io.MouseDrawCursor is set) and most debug overlays.
+    ImVector<ImGuiDrawListAttachment> ForegroundDrawListsAttached; // Draw lists rendered after ForegroundDrawList this frame (see AddDrawListToForeground())
     ImGuiMouseCursor        MouseCursor;
 
     // Drag and Drop
@@ -984,7 +1167,6 @@ struct ImGuiContext
     ImPool<ImGuiTabBar>             TabBars;
     ImGuiTabBar*                    CurrentTabBar;
     ImVector<ImGuiTabBarRef>        CurrentTabBarStack;
-    ImVector<ImGuiShrinkWidthItem>  ShrinkWidthBuffer;
 
     // Widget state
     ImVec2                  LastValidMousePos;
@@ -1012,8 +1194,74 @@ struct ImGuiContext
     bool                           SettingsLoaded;
     float                          SettingsDirtyTimer;          // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer                SettingsIniData;             // In memory .ini settings
+    ImVector<char>                 SettingsBinaryData;          // In memory binary settings
     ImVector<ImGuiSettingsHandler> SettingsHandlers;            // List of .ini settings handlers
     ImVector<ImGuiWindowSettings>  SettingsWindows;             // ImGuiWindow .ini settings entries (parsed from the last loaded .ini file and maintained on saving)
+    ImGuiStorage                   SettingsWindowsMap;          // Map window ID -> index into SettingsWindows[], kept in sync by CreateNewWindowSettings()
+    ImGuiTextBuffer                SettingsWindowsIniCache;     // Serialized SettingsWindows[] entries from the last save, only changed entries are serialized again
+    int                            SettingsSaveCount;           // Statistics: number of saves
+    int                            SettingsSaveSerializedCount; // Statistics: number of window entries serialized during the last save (others were copied from cache)
+    float                          SettingsSaveToMemoryMs;      // Statistics: duration of the last SaveIniSettingsToMemory()
+    float                          SettingsSaveToDiskMs;        // Statistics: duration of the last SaveIniSettingsToDisk(), including SaveIniSettingsToMemory()
+
+    // Idle/event-driven frames (see io.NextFrameTimeout)
+    int                     FramesSinceLastInput;               // Number of frames since the last input event
+    bool                    InputEventsThisFrame;               // Set by NewFrame(): inputs of the current frame contain a mouse button, mouse wheel, keyboard, character or navigation event (mouse moves excluded)
+    float                   NextFrameTimeoutRequest;            // Minimum delay requested with RequestNextFrame() during the current frame
+    ImVec2                  NextFrameLastDisplaySize;
+
+    // Retained draw lists (see ImGuiWindowFlags_RetainDrawList)
+    int                     RetainedDrawListsReusedCount;       // Statistics: total number of primitives reused from the previous frame
+    int                     RetainedDrawListsTessellatedCount;  // Statistics: total number of primitives tessellated
+
+    // Deferred tessellation (see io.ConfigDeferTessellation)
+    ImVector<ImDrawTessellateJob> TessellateJobs;               // Jobs of the last Render()
+    int                     TessellatePrimsCount;               // Statistics: number of primitives tessellated by the last Render()
+
+    // Flattened draw data (see io.ConfigFlattenDrawData)
+    ImDrawList              FlattenedDrawList;                  // Concatenation of the draw lists of the last Render()
+    ImDrawList*             FlattenedCmdLists[1];               // == { &FlattenedDrawList }, for DrawData.CmdLists
+    ImVector<ImDrawFlattenList> FlattenLists;                   // Where each draw list is copied in FlattenedDrawList
+    int                     FlattenedListsCount;                // Statistics: number of draw lists flattened by the last Render() (0 if skipped)
+    int                     FlattenedSegmentsCount;             // Statistics: number of distinct ImDrawCmd::VtxOffset values in FlattenedDrawList
+
+    // Merged draw commands (see io.ConfigMergeDrawCmds)
+    int                     MergeDrawCmdsBeforeCount;           // Statistics: number of draw commands of the last Render() before merging
+    int                     MergeDrawCmdsAfterCount;            // Statistics: number of draw commands of the last Render() after merging
+
+    // Occlusion culling (see io.ConfigOcclusionCulling)
+    ImVector<ImRect>        Occluders;                          // Opaque rectangles of the root windows rendered by the last Render(), in back-to-front order
+    int                     OccludersInFrontIdx;                // Occluders[OccludersInFrontIdx..] are in front of the draw lists currently added to the draw data
+    ImVector<ImRect>        OcclusionCulledRects;               // Bounding boxes of the draw lists culled by the last Render() (for Metrics)
+    int                     OcclusionCulledVtxCount;            // Statistics: number of vertices culled by the last Render()
+
+    // Profiler
+    bool                    ProfilerEnabled;                    // Set to enable the frame profiler, latched by NewFrame()
+    bool                    ProfilerActive;                     // Recording the current frame
+    ImVector<ImGuiProfilerFrame> ProfilerFrames;                // Ring buffer of the last recorded frames (size fixed by ProfilerFramesCount)
+    int                     ProfilerFramesCount;                // Number of frames kept in ProfilerFrames[]
+    int                     ProfilerFrameIdx;                   // Index of the current/last recorded frame in ProfilerFrames[]
+    ImVector<int>           ProfilerScopeStack;                 // Open scopes (indices in the current frame Scopes[])
+
+    // Allocation audit
+    ImGuiAllocAuditMode     AllocAuditMode;                     // Set to flag heap allocations made after warm-up (MemAlloc() calls), latched by NewFrame()
+    int                     AllocAuditWarmupFrames;             // = 60     // Number of frames from the start of the audit during which allocations are allowed (and measured)
+    int                     AllocAuditStartFrame;               // g.FrameCount of the first warm-up frame, -1 when not auditing
+    bool                    AllocAuditActive;                   // Warm-up is over: every MemAlloc() call is recorded as a violation
+    const char*             AllocAuditTag;                      // Callsite tag stored in ImGuiAllocAuditRecord::Tag. Must be a string literal.
+    int                     AllocAuditWarmupAllocsCount;        // Number of allocations made during warm-up
+    size_t                  AllocAuditWarmupAllocsBytes;        // Number of bytes allocated during warm-up
+    int                     AllocAuditHighWaterMark;            // Highest io.MetricsActiveAllocations during warm-up
+    int                     AllocAuditViolationsCount;          // Number of allocations made after warm-up
+    ImGuiAllocAuditRecord   AllocAuditRecords[16];              // Last recorded violations, AllocAuditRecords[(AllocAuditViolationsCount - 1) % 16] is the most recent one. Fixed size so recording doesn't allocate.
+    float                   AllocReserveHeadroom;               // = 0.25f  // Pre-reservation hint applied at the end of warm-up: per-frame buffers reserve this ratio above their high-water mark, see AllocReserveFrameBuffers()
+
+    // Memory accounting
+    bool                    MemoryTagsEnabled;                  // Set to track live/peak heap bytes per subsystem and per window (see "Memory" in the Metrics window). Allocations made before enabling are untracked.
+    ImGuiMemoryTagStats     MemoryTagStats[ImGuiMemoryTag_COUNT];
+    ImGuiMemoryAlloc*       MemoryAllocs;                       // Live tracked allocations: open addressing hash table keyed by pointer. Allocated with the allocator functions directly so it doesn't track (or audit) itself.
+    int                     MemoryAllocsCapacity;               // Power of two, 0 when not tracking
+    int                     MemoryAllocsCount;
 
     // Logging
     bool                    LogEnabled;
@@ -1034,8 +1282,9 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
     char                    TempBuffer[1024*3+1];               // Temporary text buffer
+    ImArena                 FrameArena;                         // Transient allocations valid until the next NewFrame() (text which doesn't fit in TempBuffer, sort buffers...). Stats in Metrics.
 
-    ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData)
+    ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData), FlattenedDrawList(&DrawListSharedData)
     {
         Initialized = false;
         FrameScopeActive = FrameScopePushedImplicitWindow = false;
@@ -1052,6 +1301,7 @@ struct ImGuiContext
         HoveredWindow = NULL;
         HoveredRootWindow = NULL;
         MovingWindow = NULL;
+        WindowsMemoryUsage = WindowsMemoryUsagePeak = WindowsMemoryCompactedCount = 0;
 
         HoveredId = 0;
         HoveredIdAllowOverlap = false;
@@ -1142,6 +1392,41 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsWindowsMap.SetHashed(true);
+        SettingsSaveCount = SettingsSaveSerializedCount = 0;
+        SettingsSaveToMemoryMs = SettingsSaveToDiskMs = 0.0f;
+
+        FramesSinceLastInput = 0;
+        InputEventsThisFrame = false;
+        NextFrameTimeoutRequest = FLT_MAX;
+        NextFrameLastDisplaySize = ImVec2(0.0f, 0.0f);
+
+        RetainedDrawListsReusedCount = RetainedDrawListsTessellatedCount = 0;
+        TessellatePrimsCount = 0;
+        FlattenedCmdLists[0] = &FlattenedDrawList;
+        FlattenedListsCount = FlattenedSegmentsCount = 0;
+        MergeDrawCmdsBeforeCount = MergeDrawCmdsAfterCount = 0;
+        OccludersInFrontIdx = 0;
+        OcclusionCulledVtxCount = 0;
+
+        ProfilerEnabled = ProfilerActive = false;
+        ProfilerFramesCount = 120;
+        ProfilerFrameIdx = 0;
+
+        AllocAuditMode = ImGuiAllocAuditMode_None;
+        AllocAuditWarmupFrames = 60;
+        AllocAuditStartFrame = -1;
+        AllocAuditActive = false;
+        AllocAuditTag = NULL;
+        AllocAuditWarmupAllocsCount = AllocAuditHighWaterMark = AllocAuditViolationsCount = 0;
+        AllocAuditWarmupAllocsBytes = 0;
+        memset(AllocAuditRecords, 0, sizeof(AllocAuditRecords));
+        AllocReserveHeadroom = 0.25f;
+
+        MemoryTagsEnabled = false;
+        memset(MemoryTagStats, 0, sizeof(MemoryTagStats));
+        MemoryAllocs = NULL;
+        MemoryAllocsCapacity = MemoryAllocsCount = 0;
 
         LogEnabled = false;
         LogType = ImGuiLogType_None;
@@ -1302,6 +1587,7 @@ struct IMGUI_API ImGuiWindow
     ImRect                  WorkRect;                           // == InnerRect minus WindowPadding.x
     ImRect                  ContentsRegionRect;                 // FIXME: This is currently confusing/misleading. Maximum visible content position ~~ Pos + (SizeContentsExplicit ? SizeContentsExplicit : Size - ScrollbarSizes) - CursorStartPos, per axis
     int                     LastFrameActive;                    // Last frame number the window was Active.
+    float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
     float                   ItemWidthDefault;
     ImGuiMenuColumns        MenuColumns;                        // Simplified columns storage for menu items
     ImGuiStorage            StateStorage;
@@ -1311,6 +1597,14 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImDrawListRetainedData  RetainedDrawList;                   // When using ImGuiWindowFlags_RetainDrawList
+    ImVector<ImGuiDrawListAttachment> DrawListsAttached;        // Draw lists rendered after DrawList this frame (see AddDrawListToWindow())
+    ImRect                  OccluderRect;                       // Area fully covered by the opaque background and title bar this frame, if any (see io.ConfigOcclusionCulling)
+    int                     OccludersInFrontIdx;                // Set by Render(): index of the first occluder in front of this root window (see io.ConfigOcclusionCulling)
+    bool                    MemoryCompacted;                    // Set when the transient buffers of the window have been freed (see io.ConfigWindowsMemoryCompactTimer)
+    int                     MemoryDrawListIdxCapacity;          // Backup of the draw list capacities when compacting, so they are reserved at once when the window is used again
+    int                     MemoryDrawListVtxCapacity;
+    int                     MemoryTagsBytes[ImGuiMemoryTag_COUNT];  // Tracked heap bytes owned by the window per subsystem, updated by NewFrame() when g.MemoryTagsEnabled
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window.
     ImGuiWindow*            RootWindowForTitleBarHighlight;     // Point to ourself or first ancestor which will display TitleBgActive color when this window is active.
@@ -1454,6 +1748,11 @@ namespace ImGui
     IMGUI_API void          SetWindowSize(ImGuiWindow* window, const ImVec2& size, ImGuiCond cond = 0);
     IMGUI_API void          SetWindowCollapsed(ImGuiWindow* window, bool collapsed, ImGuiCond cond = 0);
 
+    // Garbage collection
+    IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API int           GcCalcWindowMemoryUsage(ImGuiWindow* window);
+
     IMGUI_API void          SetCurrentFont(ImFont* font);
     inline ImFont*          GetDefaultFont() { ImGuiContext& g = *GImGui; return g.IO.FontDefault ? g.IO.FontDefault : g.IO.Fonts->Fonts[0]; }
 
@@ -1475,6 +1774,33 @@ namespace ImGui
     IMGUI_API ImGuiWindowSettings*  FindOrCreateWindowSettings(const char* name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
 
+    // Profiler
+    // - Set g.ProfilerEnabled to record hierarchical scopes timings over the last g.ProfilerFramesCount frames (see "Profiler" in the Metrics window).
+    // - NewFrame(), EndFrame(), Render() and every Begin()/End() pair are recorded. Add your own scopes with ProfilerBeginScope()/ProfilerEndScope().
+    // - Scopes are recorded between NewFrame() and Render(), the name must persist as long as the frame is kept in the ring buffer (use a string literal).
+    IMGUI_API void                  ProfilerBeginScope(const char* name);
+    IMGUI_API void                  ProfilerEndScope();
+    IMGUI_API ImGuiProfilerFrame*   ProfilerGetFrame(int frames_ago);   // 0 = last recorded frame. Return NULL if not recorded.
+    IMGUI_API void                  ProfilerExportChromeTrace(ImGuiTextBuffer* out_buf);    // Export all recorded frames as Chrome trace JSON (chrome://tracing, Perfetto...)
+    IMGUI_API bool                  ProfilerExportChromeTraceToDisk(const char* filename);
+
+    // Allocation audit
+    // - Set g.AllocAuditMode to verify that steady-state frames don't touch the heap. The first g.AllocAuditWarmupFrames frames may allocate
+    //   (their count, bytes and active allocations high-water mark are recorded), then every MemAlloc() call is recorded in g.AllocAuditRecords[].
+    // - Set g.AllocAuditTag (string literal) around your own code to identify its allocations. Restarted by AllocAuditRestart() or when re-enabled.
+    // - Windows appearing for the first time after warm-up (e.g. a new tooltip) and windows awakened after their memory was compacted (see io.ConfigWindowsMemoryCompactTimer) allocate.
+    // - Allocations made by io.ParallelForFn worker threads are recorded without synchronization, like io.MetricsActiveAllocations.
+    IMGUI_API void                  AllocAuditRestart();
+    IMGUI_API void                  AllocReserveFrameBuffers(float headroom);   // Grow the buffers reused every frame (window draw lists, draw data layers, tab bar names...) to 'headroom' (e.g. 0.5f = +50%) above their high-water mark
+
+    // Memory accounting
+    // - Set g.MemoryTagsEnabled to track the size of every MemAlloc() allocation, see g.MemoryTagStats[] and ImGuiWindow::MemoryTagsBytes[].
+    // - Allocations start in ImGuiMemoryTag_Other. Once per frame NewFrame() finds the allocations owned by each subsystem and window, so transient allocations stay in _Other.
+    // - Not thread-safe: leave disabled if other threads allocate while this context is current (e.g. draw lists built by worker threads).
+    IMGUI_API const char*           MemoryTagGetName(ImGuiMemoryTag tag);
+    IMGUI_API void*                 MemAllocUntracked(size_t size);     // Call the allocator functions directly: not counted in io.MetricsActiveAllocations, the allocation audit or memory tags. Used by worker threads.
+    IMGUI_API void                  MemFreeUntracked(void* ptr);
+
     // Basic Accessors
     inline ImGuiID          GetItemID()     { ImGuiContext& g = *GImGui; return g.CurrentWindow->DC.LastItemId; }
     inline ImGuiID          GetActiveID()   { ImGuiContext& g = *GImGui; return g.ActiveId; }
@@ -1640,12 +1966,19 @@ namespace ImGui
 
 } // namespace ImGui
 
+// ImDrawData internals
+IMGUI_API int               ImDrawDataFlattenLayout(const ImDrawData* draw_data, ImDrawList* out_list, bool rebase_indices, ImVector<ImDrawFlattenList>* out_lists);
+IMGUI_API void              ImDrawDataFlattenCopy(ImDrawList* out_list, const ImDrawFlattenList& list);
+IMGUI_API ImRect            ImDrawIdxRangeCalcVtxBounds(const ImDrawList* draw_list, unsigned int vtx_offset, unsigned int idx_offset, unsigned int elem_count);
+
 // ImFontAtlas internals
 IMGUI_API bool              ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildRegisterDefaultCustomRects(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void              ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
 IMGUI_API void              ImFontAtlasBuildFinish(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasBuildLoadCache(ImFontAtlas* atlas, const char* filename);     // Load the output of ImFontAtlasBuildWithStbTruetype() if 'filename' was saved from the same inputs
+IMGUI_API bool              ImFontAtlasBuildSaveCache(ImFontAtlas* atlas, const char* filename);
 IMGUI_API void              ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void              ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
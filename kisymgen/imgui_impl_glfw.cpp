@@ -8,6 +8,7 @@
 //  [X] Platform: Gamepad support. Enable with 'io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad'.
 //  [x] Platform: Mouse cursor shape and visibility. Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange'. FIXME: 3 cursors types are missing from GLFW.
 //  [X] Platform: Keyboard arrays indexed using GLFW_KEY_* codes, e.g. ImGui::IsKeyPressed(GLFW_KEY_SPACE).
+//  [X] Platform: Idle/event-driven frames. Enable with ImGui_ImplGlfw_SetWaitEvents(true), NewFrame() will then wait for events up to io.NextFrameTimeout.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
 // If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
@@ -15,6 +16,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2019-07-08: Misc: Added ImGui_ImplGlfw_SetWaitEvents() to wait for events in NewFrame() when the UI doesn't need to be refreshed (see io.NextFrameTimeout).
 //  2019-05-11: Inputs: Don't filter value from character callback before calling AddInputCharacter().
 //  2019-03-12: Misc: Preserve DisplayFramebufferScale when main window is minimized.
 //  2018-11-30: Misc: Setting up io.BackendPlatformName so it can be displayed in the About Window.
@@ -48,6 +50,7 @@
 #define GLFW_HAS_WINDOW_ALPHA       (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3300) // 3.3+ glfwSetWindowOpacity
 #define GLFW_HAS_PER_MONITOR_DPI    (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3300) // 3.3+ glfwGetMonitorContentScale
 #define GLFW_HAS_VULKAN             (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3200) // 3.2+ glfwCreateWindowSurface
+#define GLFW_HAS_WAIT_EVENTS_TIMEOUT (GLFW_VERSION_MAJOR * 1000 + GLFW_VERSION_MINOR * 100 >= 3200) // 3.2+ glfwWaitEventsTimeout
 
 // Data
 enum GlfwClientApi
@@ -59,6 +62,7 @@ enum GlfwClientApi
 static GLFWwindow*          g_Window = NULL;
 static GlfwClientApi        g_ClientApi = GlfwClientApi_Unknown;
 static double               g_Time = 0.0;
+static bool                 g_WaitEvents = false;
 static bool                 g_MouseJustPressed[5] = { false, false, false, false, false };
 static GLFWcursor*          g_MouseCursors[ImGuiMouseCursor_COUNT] = { 0 };
 
@@ -303,11 +307,39 @@ static void ImGui_ImplGlfw_UpdateGamepads()
         io.BackendFlags &= ~ImGuiBackendFlags_HasGamepad;
 }
 
+void ImGui_ImplGlfw_SetWaitEvents(bool wait_events)
+{
+    g_WaitEvents = wait_events;
+}
+
+// Process pending events, sleeping until the next event or until io.NextFrameTimeout has elapsed.
+static void ImGui_ImplGlfw_WaitEvents()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    float timeout = io.NextFrameTimeout;
+    if (ImGui::GetFrameCount() == 0 || (io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad))
+        timeout = 0.0f; // Gamepads are polled, not signaled by events
+    if (timeout <= 0.0f)
+        glfwPollEvents();
+    else if (timeout == FLT_MAX)
+        glfwWaitEvents();
+    else
+#if GLFW_HAS_WAIT_EVENTS_TIMEOUT
+        glfwWaitEventsTimeout((double)timeout);
+#else
+        glfwPollEvents();
+#endif
+}
+
 void ImGui_ImplGlfw_NewFrame()
 {
     ImGuiIO& io = ImGui::GetIO();
     IM_ASSERT(io.Fonts->IsBuilt() && "Font atlas not built! It is generally built by the renderer back-end. Missing call to renderer _NewFrame() function? e.g. ImGui_ImplOpenGL3_NewFrame().");
 
+    // Wait for events (when enabled with ImGui_ImplGlfw_SetWaitEvents)
+    if (g_WaitEvents)
+        ImGui_ImplGlfw_WaitEvents();
+
     // Setup display size (every frame to accommodate for window resizing)
     int w, h;
     int display_w, display_h;
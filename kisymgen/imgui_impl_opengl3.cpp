@@ -13,6 +13,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2019-07-15: OpenGL: Support for compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h): 16-bit fixed point positions are scaled back in the projection matrix.
 //  2019-05-29: OpenGL: Desktop GL only: Added support for large mesh (64K+ vertices), enable ImGuiBackendFlags_RendererHasVtxOffset flag.
 //  2019-04-30: OpenGL: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2019-03-29: OpenGL: Not calling glBindBuffer more than necessary in the render loop.
@@ -183,10 +184,15 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float R = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
     float T = draw_data->DisplayPos.y;
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = 1.0f / IM_DRAWVERT_POS_SCALE; // Positions are stored in fixed point, see ImDrawVertPos16
+#else
+    const float S = 1.0f;
+#endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
+        { 2.0f*S/(R-L), 0.0f,         0.0f,   0.0f },
+        { 0.0f,         2.0f*S/(T-B), 0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
@@ -208,8 +214,13 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glEnableVertexAttribArray(g_AttribLocationVtxPos);
     glEnableVertexAttribArray(g_AttribLocationVtxUV);
     glEnableVertexAttribArray(g_AttribLocationVtxColor);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_SHORT,          GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#else
     glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
     glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#endif
     glVertexAttribPointer(g_AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
 }
 
@@ -258,6 +269,31 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         clip_origin_lower_left = false;
 #endif
 
+    // Upload glyphs rasterized since last frame (ImFontAtlasFlags_DynamicGlyphs), one rectangle per modified page.
+    // Without GL_UNPACK_ROW_LENGTH (GL ES 2.0) we upload whole rows of each rectangle instead.
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->IsTexDirty() && atlas->TexPixelsRGBA32 && g_FontTexture)
+    {
+        glBindTexture(GL_TEXTURE_2D, g_FontTexture);
+#ifdef GL_UNPACK_ROW_LENGTH
+        GLint last_unpack_row_length; glGetIntegerv(GL_UNPACK_ROW_LENGTH, &last_unpack_row_length);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas->TexWidth);
+#endif
+        for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+        {
+            const ImFontAtlas::TexDirtyRect& rect = atlas->TexDirtyRects[n];
+#ifdef GL_UNPACK_ROW_LENGTH
+            glTexSubImage2D(GL_TEXTURE_2D, 0, rect.X0, rect.Y0, rect.X1 - rect.X0, rect.Y1 - rect.Y0, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + rect.Y0 * atlas->TexWidth + rect.X0);
+#else
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, rect.Y0, atlas->TexWidth, rect.Y1 - rect.Y0, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + rect.Y0 * atlas->TexWidth);
+#endif
+        }
+#ifdef GL_UNPACK_ROW_LENGTH
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, last_unpack_row_length);
+#endif
+        atlas->ClearTexDirty();
+    }
+
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
@@ -5,9 +5,22 @@
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl3.h"
+#include "../../misc/record/imgui_input_record.h"
 #include <stdio.h>
 #include <stdlib.h>         // NULL, malloc, free, atoi
+#include <string.h>         // strcmp
+#include <chrono>           // Replay statistics
 #include <math.h>           // sqrtf, powf, cosf, sinf, floorf, ceilf
+#include <string>
+#include <thread>           // IniBackgroundWriter
+#include <mutex>
+#include <condition_variable>
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>        // MoveFileExA
+#endif
 
 
 // About OpenGL function loaders: modern OpenGL doesn't have a standard header file and requires individual function pointers to be loaded manually.
@@ -367,8 +380,109 @@ static void preview_draw_lrtb_sym(int symbol_width_default, int pin_distance, in
     }
 }
 
-int main(int, char**)
+// Write .ini settings from a worker thread so the frame which triggers a save never blocks on disk I/O.
+// We disable dear imgui automatic saving (io.IniFilename = NULL), and when io.WantSaveIniSettings is set we call
+// SaveIniSettingsToMemory() (which only re-serialize windows that changed) and hand over a copy of the data.
+// The worker writes to a temporary file and renames it over the destination, so a crash never leaves a truncated .ini.
+struct IniBackgroundWriter
 {
+    std::string             Filename;
+    std::string             PendingData;
+    bool                    HasPendingData = false;
+    bool                    Quit = false;
+    std::thread             Thread;
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+
+    void Start(const char* filename)
+    {
+        Filename = filename;
+        Thread = std::thread([this]() { Run(); });
+    }
+
+    // Called from the UI thread. If a previous request hasn't been written yet it is replaced.
+    void Submit(const char* data, size_t data_size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            PendingData.assign(data, data_size);
+            HasPendingData = true;
+        }
+        Cond.notify_one();
+    }
+
+    // Flush pending data and wait for the worker to exit.
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            Quit = true;
+        }
+        Cond.notify_one();
+        if (Thread.joinable())
+            Thread.join();
+    }
+
+    void Run()
+    {
+        std::string data;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(Mutex);
+                Cond.wait(lock, [this]() { return HasPendingData || Quit; });
+                if (!HasPendingData)
+                    return;
+                data.swap(PendingData);
+                HasPendingData = false;
+            }
+            WriteAtomic(data);
+        }
+    }
+
+    void WriteAtomic(const std::string& data)
+    {
+        std::string tmp_filename = Filename + ".tmp";
+        FILE* f = fopen(tmp_filename.c_str(), "wb");
+        if (!f)
+            return;
+        bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+        ok &= fclose(f) == 0;
+        if (!ok)
+        {
+            remove(tmp_filename.c_str());
+            return;
+        }
+#ifdef _WIN32
+        MoveFileExA(tmp_filename.c_str(), Filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+        rename(tmp_filename.c_str(), Filename.c_str());
+#endif
+    }
+};
+
+int main(int argc, char** argv)
+{
+    // Command-line: --record <file> records the inputs of the session, --replay <file> replays them and prints frame statistics.
+    // Both start without loading/saving imgui.ini so that replayed sessions start from the same state as the recorded one.
+    const char* record_filename = NULL;
+    const char* replay_filename = NULL;
+    for (int arg_n = 1; arg_n + 1 < argc; arg_n++)
+    {
+        if (strcmp(argv[arg_n], "--record") == 0)
+            record_filename = argv[++arg_n];
+        else if (strcmp(argv[arg_n], "--replay") == 0)
+            replay_filename = argv[++arg_n];
+    }
+    const bool use_ini = (record_filename == NULL && replay_filename == NULL);
+    ImGuiInputRecorder input_recorder;
+    ImGuiInputReplayer input_replayer;
+    if (replay_filename && !input_replayer.LoadFromFile(replay_filename))
+    {
+        fprintf(stderr, "Failed to load input record '%s'!\n", replay_filename);
+        return 1;
+    }
+
     // Setup window
     glfwSetErrorCallback(glfw_error_callback);
     if (!glfwInit())
@@ -396,7 +510,7 @@ int main(int, char**)
     if (window == NULL)
         return 1;
     glfwMakeContextCurrent(window);
-    glfwSwapInterval(1); // Enable vsync
+    glfwSwapInterval(replay_filename ? 0 : 1); // Enable vsync (disabled when replaying, to replay as fast as possible)
 
     // Initialize OpenGL loader
 #if defined(IMGUI_IMPL_OPENGL_LOADER_GL3W)
@@ -418,6 +532,13 @@ int main(int, char**)
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO(); (void)io;
+    io.IniFilename = NULL;  // Saving is handled by IniBackgroundWriter
+    IniBackgroundWriter ini_writer;
+    if (use_ini)
+    {
+        ImGui::LoadIniSettingsFromDisk("imgui.ini");
+        ini_writer.Start("imgui.ini");
+    }
     //io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;  // Enable Keyboard Controls
     //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;   // Enable Gamepad Controls
 
@@ -428,6 +549,8 @@ int main(int, char**)
     // Setup Platform/Renderer bindings
     ImGui_ImplGlfw_InitForOpenGL(window, true);
     ImGui_ImplOpenGL3_Init(glsl_version);
+    const bool wait_events = (replay_filename == NULL);     // Idle when nothing changes (see io.NextFrameTimeout). Disabled when replaying, to replay as fast as possible.
+    ImGui_ImplGlfw_SetWaitEvents(wait_events);
 
     // Load Fonts
     // - If no fonts are loaded, dear imgui will use the default font. You can also load multiple fonts and use ImGui::PushFont()/PopFont() to select them.
@@ -456,14 +579,31 @@ int main(int, char**)
 
     ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 
+    // Replay statistics
+    double replay_frames_ns = 0.0, replay_vtx_count = 0.0, replay_idx_count = 0.0;
+    int replay_frames_count = 0;
+
     // Main loop
     while (!glfwWindowShouldClose(window))
     {
-        glfwPollEvents();
+        if (!wait_events)
+            glfwPollEvents();           // Otherwise events are processed by ImGui_ImplGlfw_NewFrame()
 
         // Start the Dear ImGui frame
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
+        bool replaying_frame = false;
+        if (replay_filename)
+        {
+            replaying_frame = input_replayer.ReplayFrame(io);
+            if (!replaying_frame)
+                glfwSetWindowShouldClose(window, 1);
+        }
+        else if (record_filename)
+        {
+            input_recorder.RecordFrame(io);
+        }
+        std::chrono::steady_clock::time_point frame_start_time = std::chrono::steady_clock::now();
         ImGui::NewFrame();
 
         // 1. Show the big demo window (Most of the sample code is in ImGui::ShowDemoWindow()! You can browse its code to learn more about Dear ImGui!).
@@ -756,6 +896,13 @@ int main(int, char**)
         }
         // Rendering
         ImGui::Render();
+        if (replaying_frame)
+        {
+            replay_frames_ns += (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - frame_start_time).count();
+            replay_vtx_count += ImGui::GetDrawData()->TotalVtxCount;
+            replay_idx_count += ImGui::GetDrawData()->TotalIdxCount;
+            replay_frames_count++;
+        }
         int display_w, display_h;
         glfwMakeContextCurrent(window);
         glfwGetFramebufferSize(window, &display_w, &display_h);
@@ -766,9 +913,35 @@ int main(int, char**)
 
         glfwMakeContextCurrent(window);
         glfwSwapBuffers(window);
+
+        // Hand over .ini data to the background writer
+        if (io.WantSaveIniSettings && use_ini)
+        {
+            size_t ini_size = 0;
+            const char* ini_data = ImGui::SaveIniSettingsToMemory(&ini_size);
+            ini_writer.Submit(ini_data, ini_size);
+            io.WantSaveIniSettings = false;
+        }
+    }
+
+    // Report replay statistics (same format as misc/benchmark/)
+    if (replay_filename && replay_frames_count > 0)
+    {
+        printf("{\"bench\":\"kisymgen_replay\",\"case\":\"%s\",\"metric\":\"ns_per_frame\",\"value\":%.3f}\n", replay_filename, replay_frames_ns / replay_frames_count);
+        printf("{\"bench\":\"kisymgen_replay\",\"case\":\"%s\",\"metric\":\"vtx_per_frame\",\"value\":%.3f}\n", replay_filename, replay_vtx_count / replay_frames_count);
+        printf("{\"bench\":\"kisymgen_replay\",\"case\":\"%s\",\"metric\":\"idx_per_frame\",\"value\":%.3f}\n", replay_filename, replay_idx_count / replay_frames_count);
     }
+    if (record_filename && !input_recorder.SaveToFile(record_filename))
+        fprintf(stderr, "Failed to save input record '%s'!\n", record_filename);
 
     // Cleanup
+    if (use_ini)
+    {
+        size_t ini_size = 0;
+        const char* ini_data = ImGui::SaveIniSettingsToMemory(&ini_size);
+        ini_writer.Submit(ini_data, ini_size);
+        ini_writer.Stop();
+    }
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
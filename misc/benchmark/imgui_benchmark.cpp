@@ -0,0 +1,2678 @@
+// dear imgui: micro-benchmarks
+// Headless, no renderer or platform back-end required. See Makefile for build instructions.
+// Results are printed one per line as JSON objects so they can be collected and compared across builds:
+//   {"bench":"hash_str","case":"len=16","metric":"ns_per_call","value":12.34}
+
+#include "imgui.h"
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui_internal.h"
+#include "../record/imgui_input_record.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+static double GetTimeNs()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void BenchReport(const char* bench, const char* case_name, const char* metric, double value)
+{
+    printf("{\"bench\":\"%s\",\"case\":\"%s\",\"metric\":\"%s\",\"value\":%.3f}\n", bench, case_name, metric, value);
+}
+
+// Prevent the compiler from optimizing away results
+static volatile ImU32 GBenchSink = 0;
+
+// Count allocations made by dear imgui (installed with ImGui::SetAllocatorFunctions() in main), draw lists may be built on worker threads
+static std::atomic<int> GBenchAllocCount(0);
+static void* BenchMallocWrapper(size_t size, void* user_data) { IM_UNUSED(user_data); GBenchAllocCount++; return malloc(size); }
+static void  BenchFreeWrapper(void* ptr, void* user_data)     { IM_UNUSED(user_data); free(ptr); }
+
+// Number of measured frames for frame benchmarks, set with --frames=N
+static int GBenchFramesCount = 300;
+
+// Input record to replay with --replay=filename, and file to save the scripted inputs to with --record=filename
+static const char* GBenchReplayFilename = NULL;
+static const char* GBenchRecordFilename = NULL;
+
+// Minimal thread pool implementing io.ParallelForFn: the calling thread and the workers pull job indices from a shared counter.
+static const int BENCH_THREADS_MAX = 16;
+struct BenchThreadPool
+{
+    std::thread             Workers[BENCH_THREADS_MAX - 1];
+    int                     WorkersCount;
+    std::mutex              Mutex;
+    std::condition_variable WakeUp;
+    std::condition_variable Done;
+    void                    (*Func)(void* data, int n);
+    void*                   Data;
+    int                     Count;
+    std::atomic<int>        Next;
+    int                     Pending;        // Workers which haven't finished the current batch
+    int                     Batch;
+    bool                    Quit;
+
+    // 'threads_count' includes the calling thread
+    BenchThreadPool(int threads_count) : Func(NULL), Data(NULL), Count(0), Next(0), Pending(0), Batch(0), Quit(false)
+    {
+        WorkersCount = ImClamp(threads_count, 1, BENCH_THREADS_MAX) - 1;
+        for (int n = 0; n < WorkersCount; n++)
+            Workers[n] = std::thread([this]() { WorkerMain(); });
+    }
+    ~BenchThreadPool()
+    {
+        { std::lock_guard<std::mutex> lock(Mutex); Quit = true; }
+        WakeUp.notify_all();
+        for (int n = 0; n < WorkersCount; n++)
+            Workers[n].join();
+    }
+    void RunJobs()
+    {
+        for (int n = Next++; n < Count; n = Next++)
+            Func(Data, n);
+    }
+    void WorkerMain()
+    {
+        int batch = 0;
+        std::unique_lock<std::mutex> lock(Mutex);
+        for (;;)
+        {
+            WakeUp.wait(lock, [&]() { return Quit || Batch != batch; });
+            if (Quit)
+                return;
+            batch = Batch;
+            lock.unlock();
+            RunJobs();
+            lock.lock();
+            if (--Pending == 0)
+                Done.notify_one();
+        }
+    }
+    static void ParallelFor(void* user_data, void (*func)(void* data, int n), void* data, int count)
+    {
+        BenchThreadPool* pool = (BenchThreadPool*)user_data;
+        {
+            std::lock_guard<std::mutex> lock(pool->Mutex);
+            pool->Func = func;
+            pool->Data = data;
+            pool->Count = count;
+            pool->Next = 0;
+            pool->Pending = pool->WorkersCount;
+            pool->Batch++;
+        }
+        pool->WakeUp.notify_all();
+        pool->RunJobs();
+        std::unique_lock<std::mutex> lock(pool->Mutex);
+        pool->Done.wait(lock, [&]() { return pool->Pending == 0; });
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Benchmark: ImHashStr() / ImHashData()
+//-----------------------------------------------------------------------------
+
+// Reference byte-at-a-time implementation, matching the default ImHashStr() loop.
+static ImU32 GReferenceCrc32Table[256];
+
+static void ReferenceCrc32Init()
+{
+    for (ImU32 n = 0; n < 256; n++)
+    {
+        ImU32 crc = n;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+        GReferenceCrc32Table[n] = crc;
+    }
+}
+
+static ImU32 ReferenceHashStr(const char* data_p, ImU32 seed)
+{
+    seed = ~seed;
+    ImU32 crc = seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    while (unsigned char c = *data++)
+    {
+        if (c == '#' && data[0] == '#' && data[1] == '#')
+            crc = seed;
+        crc = (crc >> 8) ^ GReferenceCrc32Table[(crc & 0xFF) ^ c];
+    }
+    return ~crc;
+}
+
+static void Bench_Hash()
+{
+    ReferenceCrc32Init();
+
+    const int LABELS_COUNT = 1024;
+    const int label_lengths[] = { 4, 8, 16, 24, 32, 64, 256 };
+    char* labels = (char*)IM_ALLOC(LABELS_COUNT * 260);
+    for (int len_n = 0; len_n < IM_ARRAYSIZE(label_lengths); len_n++)
+    {
+        // Generate labels of the requested length, some of them using the "label###id" syntax
+        const int len = label_lengths[len_n];
+        for (int n = 0; n < LABELS_COUNT; n++)
+        {
+            char* label = labels + n * 260;
+            for (int c = 0; c < len; c++)
+                label[c] = "abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789#"[(n * 7 + c * 13) % 64];
+            label[len] = 0;
+            if ((n % 8) == 0 && len >= 8)
+                memcpy(label + len / 2, "###", 3);
+        }
+
+        // Validate
+        for (int n = 0; n < LABELS_COUNT; n++)
+        {
+            const char* label = labels + n * 260;
+            ImU32 seed = (ImU32)n * 0x9E3779B9;
+            if (ImHashStr(label, 0, seed) != ReferenceHashStr(label, seed) || ImHashStr(label, (size_t)len, seed) != ReferenceHashStr(label, seed))
+            {
+                fprintf(stderr, "ImHashStr() mismatch with reference implementation for \"%s\"!\n", label);
+                exit(1);
+            }
+            if (memchr(label, '#', len) == NULL && ImHashData(label, (size_t)len, seed) != ReferenceHashStr(label, seed))
+            {
+                fprintf(stderr, "ImHashData() mismatch with reference implementation for \"%s\"!\n", label);
+                exit(1);
+            }
+        }
+
+        // Measure
+        char case_name[32];
+        ImFormatString(case_name, IM_ARRAYSIZE(case_name), "len=%d", len);
+        const int iterations = ImMax(200, 200000 / len);
+        ImU32 acc = 0;
+        double t0 = GetTimeNs();
+        for (int it = 0; it < iterations; it++)
+            for (int n = 0; n < LABELS_COUNT; n++)
+                acc += ReferenceHashStr(labels + n * 260, acc);
+        double t1 = GetTimeNs();
+        for (int it = 0; it < iterations; it++)
+            for (int n = 0; n < LABELS_COUNT; n++)
+                acc += ImHashStr(labels + n * 260, 0, acc);
+        double t2 = GetTimeNs();
+        for (int it = 0; it < iterations; it++)
+            for (int n = 0; n < LABELS_COUNT; n++)
+                acc += ImHashData(labels + n * 260, (size_t)len, acc);
+        double t3 = GetTimeNs();
+        GBenchSink += acc;
+
+        const double calls = (double)iterations * LABELS_COUNT;
+        BenchReport("hash_str_reference", case_name, "ns_per_call", (t1 - t0) / calls);
+        BenchReport("hash_str", case_name, "ns_per_call", (t2 - t1) / calls);
+        BenchReport("hash_data", case_name, "ns_per_call", (t3 - t2) / calls);
+    }
+    IM_FREE(labels);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: ImGuiStorage (sorted vs hashed)
+//-----------------------------------------------------------------------------
+
+static void Bench_Storage()
+{
+    const int keys_counts[] = { 1000, 10000, 100000 };
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(keys_counts); count_n++)
+    {
+        const int keys_count = keys_counts[count_n];
+        ImVector<ImGuiID> keys;
+        keys.resize(keys_count);
+        for (int n = 0; n < keys_count; n++)
+            keys[n] = ImHashData(&n, sizeof(n), 0x1234);
+
+        char case_name[32];
+        ImFormatString(case_name, IM_ARRAYSIZE(case_name), "keys=%d", keys_count);
+        for (int hashed = 0; hashed < 2; hashed++)
+        {
+            const char* bench_name_insert = hashed ? "storage_hashed_insert" : "storage_sorted_insert";
+            const char* bench_name_lookup = hashed ? "storage_hashed_lookup" : "storage_sorted_lookup";
+            const char* bench_name_remove = hashed ? "storage_hashed_remove" : "storage_sorted_remove";
+
+            ImGuiStorage storage;
+            storage.SetHashed(hashed != 0);
+            double t0 = GetTimeNs();
+            for (int n = 0; n < keys_count; n++)
+                storage.SetInt(keys[n], n);
+            double t1 = GetTimeNs();
+
+            const int lookup_passes = ImMax(1, 1000000 / keys_count);
+            int acc = 0;
+            for (int pass = 0; pass < lookup_passes; pass++)
+                for (int n = 0; n < keys_count; n++)
+                    acc += storage.GetInt(keys[n], -1);
+            double t2 = GetTimeNs();
+            GBenchSink += (ImU32)acc;
+            for (int n = 0; n < keys_count; n++)
+                if (storage.GetInt(keys[n], -1) != n)
+                {
+                    fprintf(stderr, "ImGuiStorage lookup mismatch!\n");
+                    exit(1);
+                }
+
+            double t3 = GetTimeNs();
+            for (int n = 0; n < keys_count; n += 2)
+                storage.Remove(keys[n]);
+            double t4 = GetTimeNs();
+            for (int n = 0; n < keys_count; n++)
+                if (storage.GetInt(keys[n], -1) != ((n & 1) ? n : -1))
+                {
+                    fprintf(stderr, "ImGuiStorage lookup mismatch after Remove()!\n");
+                    exit(1);
+                }
+
+            BenchReport(bench_name_insert, case_name, "ns_per_key", (t1 - t0) / keys_count);
+            BenchReport(bench_name_lookup, case_name, "ns_per_key", (t2 - t1) / ((double)keys_count * lookup_passes));
+            BenchReport(bench_name_remove, case_name, "ns_per_key", (t4 - t3) / (keys_count / 2));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: .ini settings loading
+//-----------------------------------------------------------------------------
+
+static void Bench_IniLoad()
+{
+    const int entries_counts[] = { 1000, 10000 };
+    for (int count_n = 0; count_n < IM_ARRAYSIZE(entries_counts); count_n++)
+    {
+        // Mix of regular windows and popups, as found in .ini files of long-lived sessions
+        const int entries_count = entries_counts[count_n];
+        ImGuiTextBuffer ini;
+        for (int n = 0; n < entries_count; n++)
+        {
+            if (n & 1)
+                ini.appendf("[Window][##Popup_%08x]\n", ImHashData(&n, sizeof(n)));
+            else
+                ini.appendf("[Window][Tool Window %05d]\n", n);
+            ini.appendf("Pos=%d,%d\nSize=%d,%d\nCollapsed=%d\n\n", 60 + n % 500, 60 + n % 300, 400, 300, n % 3 == 0);
+        }
+
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ImGui::GetIO().IniFilename = NULL;
+        double t0 = GetTimeNs();
+        ImGui::LoadIniSettingsFromMemory(ini.c_str(), (size_t)ini.size());
+        double t1 = GetTimeNs();
+        ImGui::SaveIniSettingsToMemory();
+        double t2 = GetTimeNs();
+        const int serialized_count_full = ctx->SettingsSaveSerializedCount;
+        ImGui::SaveIniSettingsToMemory();
+        double t3 = GetTimeNs();
+        const int serialized_count_incremental = ctx->SettingsSaveSerializedCount;
+        if (ctx->SettingsWindows.Size != entries_count || serialized_count_full != entries_count || serialized_count_incremental != 0)
+        {
+            fprintf(stderr, "Unexpected settings entries count!\n");
+            exit(1);
+        }
+        if (strcmp(ImGui::SaveIniSettingsToMemory(), ini.c_str()) != 0)
+        {
+            fprintf(stderr, "Saved .ini data doesn't match loaded data!\n");
+            exit(1);
+        }
+        size_t binary_size = 0;
+        double t4 = GetTimeNs();
+        const void* binary_data = ImGui::SaveBinarySettingsToMemory(&binary_size);
+        double t5 = GetTimeNs();
+        ImVector<char> binary;
+        binary.resize((int)binary_size);
+        memcpy(binary.Data, binary_data, binary_size);
+        ImGui::DestroyContext(ctx);
+
+        // Binary round-trip: must load back to the exact same .ini text
+        ctx = ImGui::CreateContext();
+        ImGui::GetIO().IniFilename = NULL;
+        double t6 = GetTimeNs();
+        const bool binary_loaded = ImGui::LoadBinarySettingsFromMemory(binary.Data, binary_size);
+        double t7 = GetTimeNs();
+        if (!binary_loaded || ctx->SettingsWindows.Size != entries_count || strcmp(ImGui::SaveIniSettingsToMemory(), ini.c_str()) != 0)
+        {
+            fprintf(stderr, "Binary settings round-trip doesn't match .ini data!\n");
+            exit(1);
+        }
+        ImGui::DestroyContext(ctx);
+
+        char case_name[32];
+        ImFormatString(case_name, IM_ARRAYSIZE(case_name), "entries=%d", entries_count);
+        BenchReport("ini_load", case_name, "ms", (t1 - t0) / 1000000.0);
+        BenchReport("ini_save", case_name, "ms", (t2 - t1) / 1000000.0);
+        BenchReport("ini_save_unchanged", case_name, "ms", (t3 - t2) / 1000000.0);
+        BenchReport("ini_size", case_name, "bytes", (double)ini.size());
+        BenchReport("binary_settings_load", case_name, "ms", (t7 - t6) / 1000000.0);
+        BenchReport("binary_settings_save", case_name, "ms", (t5 - t4) / 1000000.0);
+        BenchReport("binary_settings_size", case_name, "bytes", (double)binary_size);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: full frames (ShowDemoWindow + synthetic stress windows) with scripted inputs
+//-----------------------------------------------------------------------------
+
+static const int STRESS_WINDOWS_MAX = 64;
+
+// Stress windows state, reset for each run so runs are reproducible
+struct StressWindowsState
+{
+    bool    Checks[STRESS_WINDOWS_MAX][8];
+    float   Sliders[STRESS_WINDOWS_MAX][8];
+    char    Inputs[STRESS_WINDOWS_MAX][64];
+};
+static StressWindowsState GStressWindowsState;
+
+// Animated windows change their contents every frame (frame counter, plot, custom rendering), non-animated windows only change on interactions.
+static void ShowStressWindow(int window_n, int frame_n, ImGuiWindowFlags flags)
+{
+    StressWindowsState& state = GStressWindowsState;
+    char title[32];
+    ImFormatString(title, IM_ARRAYSIZE(title), "Stress %02d", window_n);
+    ImGui::SetNextWindowPos(ImVec2(20.0f + (window_n % 6) * 310.0f, 20.0f + (window_n / 6) * 260.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(300.0f, 250.0f), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin(title, NULL, flags))
+    {
+        ImGui::Text("Frame %d, window %d", frame_n, window_n);
+        for (int n = 0; n < 8; n++)
+        {
+            ImGui::PushID(n);
+            ImGui::Button("Button");
+            ImGui::SameLine();
+            ImGui::Checkbox("##check", &state.Checks[window_n][n]);
+            ImGui::SameLine();
+            ImGui::SliderFloat("##slider", &state.Sliders[window_n][n], 0.0f, 1.0f);
+            ImGui::PopID();
+        }
+        ImGui::InputText("Input", state.Inputs[window_n], IM_ARRAYSIZE(state.Inputs[window_n]));
+
+        float plot_values[64];
+        for (int n = 0; n < IM_ARRAYSIZE(plot_values); n++)
+            plot_values[n] = sinf((n + frame_n) * 0.2f + window_n);
+        ImGui::PlotLines("##plot", plot_values, IM_ARRAYSIZE(plot_values), 0, NULL, -1.0f, 1.0f, ImVec2(0.0f, 40.0f));
+
+        if (ImGui::CollapsingHeader("Tree", ImGuiTreeNodeFlags_DefaultOpen))
+            for (int n = 0; n < 10; n++)
+                if (ImGui::TreeNodeEx((void*)(intptr_t)n, ImGuiTreeNodeFlags_DefaultOpen, "Node %d", n))
+                {
+                    ImGui::BulletText("Leaf %d.%d", n, frame_n % 100);
+                    ImGui::TreePop();
+                }
+
+        ImGui::Columns(3, "columns");
+        for (int n = 0; n < 30; n++)
+        {
+            ImGui::Text("Cell %d", n);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+
+        // Custom rendering
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        const ImVec2 p = ImGui::GetCursorScreenPos();
+        for (int n = 0; n < 32; n++)
+        {
+            const float a = (n + frame_n) * 0.1f;
+            draw_list->AddLine(ImVec2(p.x + n * 8.0f, p.y), ImVec2(p.x + 140.0f + cosf(a) * 100.0f, p.y + 50.0f + sinf(a) * 40.0f), IM_COL32(255, n * 8, 0, 255), 1.5f);
+        }
+        draw_list->AddCircleFilled(ImVec2(p.x + 40.0f, p.y + 60.0f), 30.0f, IM_COL32(0, 128, 255, 200), 24);
+        draw_list->AddRect(ImVec2(p.x + 100.0f, p.y + 20.0f), ImVec2(p.x + 200.0f, p.y + 90.0f), IM_COL32(255, 255, 255, 255), 8.0f, ImDrawCornerFlags_All, 2.0f);
+        draw_list->AddBezierCurve(ImVec2(p.x, p.y + 100.0f), ImVec2(p.x + 80.0f, p.y), ImVec2(p.x + 160.0f, p.y + 100.0f), ImVec2(p.x + 240.0f, p.y), IM_COL32(0, 255, 0, 255), 2.0f);
+        draw_list->AddText(ImVec2(p.x + 10.0f, p.y + 80.0f), IM_COL32(255, 255, 0, 255), "Custom rendering");
+        ImGui::Dummy(ImVec2(260.0f, 100.0f));
+
+        ImGui::TextWrapped("Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris.");
+    }
+    ImGui::End();
+}
+
+// Plot-heavy dashboard window: long animated waveforms, mostly stroking and filling work.
+static void ShowPlotWindow(int window_n, int frame_n)
+{
+    char title[32];
+    ImFormatString(title, IM_ARRAYSIZE(title), "Plots %02d", window_n);
+    ImGui::SetNextWindowPos(ImVec2(20.0f + (window_n % 4) * 470.0f, 20.0f + (window_n / 4) * 520.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(460.0f, 510.0f), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin(title))
+    {
+        float values[400];
+        for (int plot_n = 0; plot_n < 4; plot_n++)
+        {
+            for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+                values[n] = sinf((n + frame_n) * 0.05f * (plot_n + 1) + window_n) * cosf(n * 0.013f);
+            ImGui::PushID(plot_n);
+            ImGui::PlotLines("##plot", values, IM_ARRAYSIZE(values), 0, NULL, -1.0f, 1.0f, ImVec2(-1.0f, 50.0f));
+            ImGui::PopID();
+        }
+
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        const ImVec2 p = ImGui::GetCursorScreenPos();
+        const float width = ImGui::GetContentRegionAvailWidth();
+        ImVec2 points[600];
+        for (int wave_n = 0; wave_n < 6; wave_n++)
+        {
+            for (int n = 0; n < IM_ARRAYSIZE(points); n++)
+                points[n] = ImVec2(p.x + width * n / IM_ARRAYSIZE(points), p.y + 100.0f + sinf((n + frame_n * (wave_n + 1)) * 0.03f) * (30.0f + wave_n * 10.0f));
+            draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(255, 40 * wave_n, 255 - 40 * wave_n, 255), false, (wave_n & 1) ? 2.0f : 1.0f);
+        }
+        for (int n = 0; n < 16; n++)
+            draw_list->AddCircleFilled(ImVec2(p.x + 14.0f + n * 26.0f, p.y + 230.0f + sinf((n + frame_n) * 0.1f) * 8.0f), 10.0f, IM_COL32(0, 128, 255, 200), 24);
+        ImGui::Dummy(ImVec2(width, 250.0f));
+    }
+    ImGui::End();
+}
+
+// Deterministic inputs: mouse sweeping the screen with periodic click-and-drag, wheel and typing.
+static void BenchScriptInputs(ImGuiIO& io, int frame_n)
+{
+    const float t = frame_n * io.DeltaTime;
+    io.MousePos = ImVec2(io.DisplaySize.x * (0.5f + 0.45f * sinf(t * 0.7f)), io.DisplaySize.y * (0.5f + 0.45f * sinf(t * 1.3f)));
+    io.MouseDown[0] = (frame_n % 40) >= 30;
+    io.MouseWheel = (frame_n % 100 == 50) ? -1.0f : 0.0f;
+    if (frame_n % 20 == 0)
+        io.AddInputCharacter('a' + (frame_n / 20) % 26);
+}
+
+// Open the demo sections and enlarge the demo window, so the benchmark covers more than the collapsed headers.
+static void BenchExpandDemoWindow()
+{
+    ImGuiWindow* window = ImGui::FindWindowByName("Dear ImGui Demo");
+    if (window == NULL)
+        return;
+    const char* labels[] = { "Configuration", "Window options", "Widgets", "Layout", "Columns", "Basic", "Trees", "Text", "Combo", "Selectables", "Text Input", "Plots Widgets", "Color/Picker Widgets" };
+    for (int n = 0; n < IM_ARRAYSIZE(labels); n++)
+        window->StateStorage.SetInt(ImHashStr(labels[n], 0, window->ID), 1);
+    ImGui::SetWindowSize(window->Name, ImVec2(800.0f, 1050.0f));
+}
+
+struct BenchFramesCase
+{
+    const char*         Name;
+    bool                ShowDemoWindow;
+    int                 StressWindows;
+    bool                StressWindowsAnimated;
+    ImGuiWindowFlags    StressWindowsFlags;
+    int                 PlotWindows;
+    int                 TessellationThreads;        // 0: inline tessellation, otherwise io.ConfigDeferTessellation with io.ParallelForFn running N threads
+};
+
+struct BenchFramesResults
+{
+    double      AtlasBuildNs;
+    double      FramesNs;
+    double      FrameNsMin;
+    double      RenderNs;                   // Time spent in Render()
+    double      VtxCount;
+    double      IdxCount;
+    double      CmdCount;
+    int         AllocCount;
+    int         FramesCount;                // Measured frames
+    ImU32       DrawDataHash;               // Hash of the draw lists contents of measured frames (if requested)
+    int         RetainedReusedCount;        // Retained draw lists statistics (ImGuiWindowFlags_RetainDrawList), including warm-up frames
+    int         RetainedTessellatedCount;
+};
+
+static const int BENCH_WARMUP_FRAMES = 30;
+
+// Run warm-up frames (not measured) followed by 'frames_count' measured frames, in a new context.
+// Inputs are scripted, or replayed from 'replayer' until the end of the record. Optionally record the inputs into 'recorder'.
+static void BenchRunFrames(const BenchFramesCase& bench_case, int frames_count, ImGuiInputRecorder* recorder, ImGuiInputReplayer* replayer, bool hash_draw_data, BenchFramesResults* out)
+{
+    IM_ASSERT(bench_case.StressWindows <= STRESS_WINDOWS_MAX);
+    memset(out, 0, sizeof(*out));
+    memset(&GStressWindowsState, 0, sizeof(GStressWindowsState));
+    out->FrameNsMin = 1e30;
+
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    BenchThreadPool* thread_pool = NULL;
+    if (bench_case.TessellationThreads > 0)
+    {
+        thread_pool = new BenchThreadPool(bench_case.TessellationThreads);
+        io.ConfigDeferTessellation = true;
+        io.ParallelForFn = (bench_case.TessellationThreads > 1) ? BenchThreadPool::ParallelFor : NULL;
+        io.ParallelForUserData = thread_pool;
+    }
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    for (int key_n = 0; key_n < ImGuiKey_COUNT; key_n++)
+        io.KeyMap[key_n] = key_n;
+
+    double t0 = GetTimeNs();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    out->AtlasBuildNs = GetTimeNs() - t0;
+
+    // Records long enough use the same warm-up as the recording run, so their measured frames match (short records use half of their frames).
+    const int warmup_frames = (replayer && replayer->FramesCount <= BENCH_WARMUP_FRAMES) ? replayer->FramesCount / 2 : BENCH_WARMUP_FRAMES;
+    for (int frame_n = 0; replayer ? true : (frame_n < warmup_frames + frames_count); frame_n++)
+    {
+        if (replayer)
+        {
+            if (!replayer->ReplayFrame(io))
+                break;
+        }
+        else
+        {
+            BenchScriptInputs(io, frame_n);
+        }
+        if (recorder)
+            recorder->RecordFrame(io);
+
+        const int alloc_count_start = GBenchAllocCount;
+        double frame_t0 = GetTimeNs();
+        ImGui::NewFrame();
+        if (bench_case.ShowDemoWindow)
+            ImGui::ShowDemoWindow();
+        for (int window_n = 0; window_n < bench_case.StressWindows; window_n++)
+            ShowStressWindow(window_n, bench_case.StressWindowsAnimated ? frame_n : 0, bench_case.StressWindowsFlags);
+        for (int window_n = 0; window_n < bench_case.PlotWindows; window_n++)
+            ShowPlotWindow(window_n, frame_n);
+        double render_t0 = GetTimeNs();
+        ImGui::Render();
+        double frame_t1 = GetTimeNs();
+        if (frame_n == 0 && bench_case.ShowDemoWindow)
+            BenchExpandDemoWindow();
+        if (frame_n < warmup_frames)
+            continue;
+
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        out->FramesCount++;
+        out->FramesNs += frame_t1 - frame_t0;
+        out->FrameNsMin = ImMin(out->FrameNsMin, frame_t1 - frame_t0);
+        out->RenderNs += frame_t1 - render_t0;
+        out->AllocCount += GBenchAllocCount - alloc_count_start;
+        out->VtxCount += draw_data->TotalVtxCount;
+        out->IdxCount += draw_data->TotalIdxCount;
+        for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+            out->CmdCount += draw_list->CmdBuffer.Size;
+            if (hash_draw_data)
+            {
+                out->DrawDataHash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), out->DrawDataHash);
+                out->DrawDataHash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), out->DrawDataHash);
+            }
+        }
+    }
+    out->RetainedReusedCount = ctx->RetainedDrawListsReusedCount;
+    out->RetainedTessellatedCount = ctx->RetainedDrawListsTessellatedCount;
+    ImGui::DestroyContext(ctx);
+    delete thread_pool;
+}
+
+static void BenchReportFrames(const char* bench, const char* case_name, const BenchFramesResults& results)
+{
+    const double frames = (double)ImMax(1, results.FramesCount);
+    BenchReport(bench, case_name, "font_atlas_build_ms", results.AtlasBuildNs / 1000000.0);
+    BenchReport(bench, case_name, "ns_per_frame", results.FramesNs / frames);
+    BenchReport(bench, case_name, "ns_per_frame_min", results.FrameNsMin);
+    BenchReport(bench, case_name, "allocs_per_frame", results.AllocCount / frames);
+    BenchReport(bench, case_name, "vtx_per_frame", results.VtxCount / frames);
+    BenchReport(bench, case_name, "idx_per_frame", results.IdxCount / frames);
+    BenchReport(bench, case_name, "cmds_per_frame", results.CmdCount / frames);
+}
+
+static const BenchFramesCase GBenchFramesCases[] =
+{
+    { "demo",           true,   0,  true,   ImGuiWindowFlags_None, 0, 0 },
+    { "stress",         false,  24, true,   ImGuiWindowFlags_None, 0, 0 },
+    { "demo_stress",    true,   24, true,   ImGuiWindowFlags_None, 0, 0 },
+};
+
+static void Bench_Frames()
+{
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(GBenchFramesCases); case_n++)
+    {
+        BenchFramesResults results;
+        BenchRunFrames(GBenchFramesCases[case_n], GBenchFramesCount, NULL, NULL, false, &results);
+        BenchReportFrames("frames", GBenchFramesCases[case_n].Name, results);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: retained draw lists (ImGuiWindowFlags_RetainDrawList)
+//-----------------------------------------------------------------------------
+
+static void Bench_Retained()
+{
+    // Non-animated stress windows with the scripted inputs (mouse sweeping over windows, periodic clicks, wheel and typing).
+    // Compare with the same windows using ImGuiWindowFlags_RetainDrawList, and with animated windows (worst case: output changes every frame).
+    static const BenchFramesCase cases[] =
+    {
+        { "static",             false,  24, false,  ImGuiWindowFlags_None,              0, 0 },
+        { "static_retained",    false,  24, false,  ImGuiWindowFlags_RetainDrawList,    0, 0 },
+        { "animated",           false,  24, true,   ImGuiWindowFlags_None,              0, 0 },
+        { "animated_retained",  false,  24, true,   ImGuiWindowFlags_RetainDrawList,    0, 0 },
+    };
+    BenchFramesResults results[IM_ARRAYSIZE(cases)];
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        BenchRunFrames(cases[case_n], GBenchFramesCount, NULL, NULL, true, &results[case_n]);
+        BenchReportFrames("retained", cases[case_n].Name, results[case_n]);
+        if (cases[case_n].StressWindowsFlags & ImGuiWindowFlags_RetainDrawList)
+        {
+            const BenchFramesResults& r = results[case_n];
+            const BenchFramesResults& r_ref = results[case_n - 1];
+            BenchReport("retained", cases[case_n].Name, "reused_pct", 100.0 * r.RetainedReusedCount / ImMax(1, r.RetainedReusedCount + r.RetainedTessellatedCount));
+            BenchReport("retained", cases[case_n].Name, "output_identical", r.DrawDataHash == r_ref.DrawDataHash ? 1.0 : 0.0);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: deferred tessellation (io.ConfigDeferTessellation)
+//-----------------------------------------------------------------------------
+
+static void Bench_Tessellation()
+{
+    // Plot-heavy dashboard windows + stress windows, tessellated inline or by Render() with 1 to 16 threads.
+    // 'render_ns' includes the tessellation when it is deferred, the output must be identical to inline tessellation.
+    static const BenchFramesCase cases[] =
+    {
+        { "inline",     false,  8,  true,   ImGuiWindowFlags_None,  8,  0 },
+        { "threads=1",  false,  8,  true,   ImGuiWindowFlags_None,  8,  1 },
+        { "threads=2",  false,  8,  true,   ImGuiWindowFlags_None,  8,  2 },
+        { "threads=4",  false,  8,  true,   ImGuiWindowFlags_None,  8,  4 },
+        { "threads=8",  false,  8,  true,   ImGuiWindowFlags_None,  8,  8 },
+        { "threads=16", false,  8,  true,   ImGuiWindowFlags_None,  8,  16 },
+    };
+    BenchReport("tessellation", "", "hardware_threads", (double)std::thread::hardware_concurrency());
+    BenchFramesResults results[IM_ARRAYSIZE(cases)];
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        BenchRunFrames(cases[case_n], GBenchFramesCount, NULL, NULL, true, &results[case_n]);
+        BenchReportFrames("tessellation", cases[case_n].Name, results[case_n]);
+        BenchReport("tessellation", cases[case_n].Name, "render_ns", results[case_n].RenderNs / ImMax(1, results[case_n].FramesCount));
+        BenchReport("tessellation", cases[case_n].Name, "output_identical", results[case_n].DrawDataHash == results[0].DrawDataHash ? 1.0 : 0.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: draw lists built on worker threads (ImGui::AddDrawListToWindow(), ImDrawList::AddDrawList())
+//-----------------------------------------------------------------------------
+
+static const int BENCH_DRAWLISTS_WINDOWS = 8;
+
+// Waveforms of one window, in coordinates relative to 'origin'
+static void BenchDrawWaveforms(ImDrawList* draw_list, const ImVec2& origin, int window_n, int frame_n)
+{
+    ImVec2 points[2000];
+    for (int wave_n = 0; wave_n < 8; wave_n++)
+    {
+        for (int n = 0; n < IM_ARRAYSIZE(points); n++)
+            points[n] = ImVec2(origin.x + n * 0.2f, origin.y + 100.0f + sinf((n + frame_n * (wave_n + 1) + window_n * 10) * 0.01f) * (20.0f + wave_n * 10.0f));
+        draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(255, 30 * wave_n, 255 - 30 * wave_n, 255), false, (wave_n & 1) ? 2.0f : 1.0f);
+    }
+    for (int n = 0; n < 32; n++)
+        draw_list->AddCircleFilled(ImVec2(origin.x + 6.0f + n * 12.0f, origin.y + 230.0f + sinf((n + frame_n) * 0.1f) * 8.0f), 5.0f, IM_COL32(0, 128, 255, 200), 12);
+}
+
+struct BenchDrawListsJobs
+{
+    ImDrawList*     DrawLists[BENCH_DRAWLISTS_WINDOWS];
+    ImVec2          Origins[BENCH_DRAWLISTS_WINDOWS];   // Absolute positions for attached lists (from the previous frame), zero for copied lists
+    int             FrameN;
+};
+
+static void BenchDrawListsJob(void* data, int n)
+{
+    BenchDrawListsJobs* jobs = (BenchDrawListsJobs*)data;
+    ImDrawList* draw_list = jobs->DrawLists[n];
+    draw_list->Clear();
+    draw_list->PushClipRectFullScreen(); // No texture pushed: AddDrawListToWindow() and AddDrawList() use the window one
+    BenchDrawWaveforms(draw_list, jobs->Origins[n], n, jobs->FrameN);
+}
+
+static void Bench_DrawLists()
+{
+    // Waveform windows drawn inline by the main thread, or built by N threads into standalone draw lists then copied
+    // into the window draw lists with ImDrawList::AddDrawList() or attached with ImGui::AddDrawListToWindow() (zero-copy).
+    // 'build_ns' is the time spent building the standalone lists, 'submit_ns' the time spent submitting windows and rendering.
+    enum { Mode_Inline, Mode_Copy, Mode_Attach };
+    struct DrawListsCase { const char* Name; int Mode; int Threads; };
+    static const DrawListsCase cases[] =
+    {
+        { "inline",             Mode_Inline,    0 },
+        { "copy_threads=1",     Mode_Copy,      1 },
+        { "copy_threads=4",     Mode_Copy,      4 },
+        { "attach_threads=1",   Mode_Attach,    1 },
+        { "attach_threads=4",   Mode_Attach,    4 },
+    };
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        const DrawListsCase& bench_case = cases[case_n];
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        unsigned char* tex_pixels = NULL;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+        BenchThreadPool thread_pool(ImMax(1, bench_case.Threads));
+        ImDrawListSharedData* shared_data = NULL;
+        BenchDrawListsJobs jobs;
+        for (int n = 0; n < BENCH_DRAWLISTS_WINDOWS; n++)
+            jobs.DrawLists[n] = NULL;
+        jobs.FrameN = 0;
+
+        double frames_ns = 0.0, build_ns = 0.0, submit_ns = 0.0, vtx_count = 0.0;
+        int frames_count = 0;
+        for (int frame_n = 0; frame_n < BENCH_WARMUP_FRAMES + GBenchFramesCount; frame_n++)
+        {
+            double t0 = GetTimeNs();
+            ImGui::NewFrame();
+            if (bench_case.Mode != Mode_Inline && shared_data == NULL)
+            {
+                // The shared data copy is taken after the first NewFrame(), which sets the font and display size.
+                shared_data = ImGui::CreateDrawListSharedData();
+                for (int n = 0; n < BENCH_DRAWLISTS_WINDOWS; n++)
+                    jobs.DrawLists[n] = IM_NEW(ImDrawList)(shared_data);
+            }
+            double t1 = GetTimeNs();
+            if (bench_case.Mode != Mode_Inline)
+            {
+                jobs.FrameN = frame_n;
+                BenchThreadPool::ParallelFor(&thread_pool, BenchDrawListsJob, &jobs, BENCH_DRAWLISTS_WINDOWS);
+            }
+            double t2 = GetTimeNs();
+            for (int window_n = 0; window_n < BENCH_DRAWLISTS_WINDOWS; window_n++)
+            {
+                char title[32];
+                ImFormatString(title, IM_ARRAYSIZE(title), "Waveforms %02d", window_n);
+                ImGui::SetNextWindowPos(ImVec2(20.0f + (window_n % 4) * 470.0f, 20.0f + (window_n / 4) * 520.0f), ImGuiCond_Always);
+                ImGui::SetNextWindowSize(ImVec2(460.0f, 300.0f), ImGuiCond_Always);
+                ImGui::Begin(title);
+                ImGui::Text("Window %d", window_n);
+                const ImVec2 origin = ImGui::GetCursorScreenPos();
+                if (bench_case.Mode == Mode_Inline)
+                    BenchDrawWaveforms(ImGui::GetWindowDrawList(), origin, window_n, frame_n);
+                else if (bench_case.Mode == Mode_Copy)
+                    ImGui::GetWindowDrawList()->AddDrawList(jobs.DrawLists[window_n], origin);
+                else
+                    ImGui::AddDrawListToWindow(jobs.DrawLists[window_n]);
+                if (bench_case.Mode == Mode_Attach)
+                    jobs.Origins[window_n] = origin;
+                ImGui::Dummy(ImVec2(400.0f, 250.0f));
+                ImGui::End();
+            }
+            ImGui::Render();
+            double t3 = GetTimeNs();
+            if (frame_n < BENCH_WARMUP_FRAMES)
+                continue;
+            frames_count++;
+            frames_ns += t3 - t0;
+            build_ns += t2 - t1;
+            submit_ns += t3 - t2;
+            vtx_count += ImGui::GetDrawData()->TotalVtxCount;
+        }
+        for (int n = 0; n < BENCH_DRAWLISTS_WINDOWS; n++)
+            IM_DELETE(jobs.DrawLists[n]);
+        if (shared_data)
+            ImGui::DestroyDrawListSharedData(shared_data);
+        ImGui::DestroyContext(ctx);
+
+        BenchReport("drawlists", bench_case.Name, "ns_per_frame", frames_ns / frames_count);
+        BenchReport("drawlists", bench_case.Name, "build_ns", build_ns / frames_count);
+        BenchReport("drawlists", bench_case.Name, "submit_ns", submit_ns / frames_count);
+        BenchReport("drawlists", bench_case.Name, "vtx_per_frame", vtx_count / frames_count);
+    }
+
+    // Self-check: one draw list attached to two windows with different clip rectangles and textures during two frames, rebuilt in between.
+    // Attaching must leave the draw list untouched, and each frame must clip it to the window it is attached to (not to both).
+    {
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        unsigned char* tex_pixels = NULL;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+        ImDrawListSharedData* shared_data = NULL;
+        ImDrawList* draw_list = NULL;
+        bool attachment_match = true;
+        for (int frame_n = 0; frame_n < 2; frame_n++)
+        {
+            ImGui::NewFrame();
+            if (shared_data == NULL)
+            {
+                shared_data = ImGui::CreateDrawListSharedData();
+                draw_list = IM_NEW(ImDrawList)(shared_data);
+            }
+            draw_list->Clear();
+            draw_list->PushClipRectFullScreen();
+            draw_list->AddRectFilled(ImVec2(0.0f, 0.0f), io.DisplaySize, IM_COL32(255, 0, 0, 128));
+            const ImVec4 list_clip_rect = draw_list->CmdBuffer[0].ClipRect;
+
+            ImVec4 window_clip_rect;
+            const ImTextureID window_texture_id = (ImTextureID)(intptr_t)(frame_n + 2);
+            for (int window_n = 0; window_n < 2; window_n++)
+            {
+                ImGui::SetNextWindowPos(window_n == 0 ? ImVec2(20.0f, 20.0f) : ImVec2(600.0f, 400.0f), ImGuiCond_Always);
+                ImGui::SetNextWindowSize(window_n == 0 ? ImVec2(300.0f, 200.0f) : ImVec2(400.0f, 250.0f), ImGuiCond_Always);
+                ImGui::Begin(window_n == 0 ? "Attach A" : "Attach B");
+                if (window_n == frame_n)
+                {
+                    ImDrawList* window_draw_list = ImGui::GetWindowDrawList();
+                    window_draw_list->PushTextureID(window_texture_id);
+                    window_clip_rect = ImVec4(window_draw_list->GetClipRectMin().x, window_draw_list->GetClipRectMin().y, window_draw_list->GetClipRectMax().x, window_draw_list->GetClipRectMax().y);
+                    ImGui::AddDrawListToWindow(draw_list);
+                    window_draw_list->PopTextureID();
+                }
+                ImGui::End();
+            }
+            const ImDrawCmd& cmd = draw_list->CmdBuffer[0];
+            if (memcmp(&cmd.ClipRect, &list_clip_rect, sizeof(ImVec4)) != 0 || cmd.TextureId != (ImTextureID)NULL)
+                attachment_match = false;
+            ImGui::Render();
+            if (memcmp(&cmd.ClipRect, &window_clip_rect, sizeof(ImVec4)) != 0 || cmd.TextureId != window_texture_id)
+                attachment_match = false;
+        }
+        IM_DELETE(draw_list);
+        ImGui::DestroyDrawListSharedData(shared_data);
+        ImGui::DestroyContext(ctx);
+        BenchReport("drawlists", "attach_two_windows", "attachment_match", attachment_match ? 1.0 : 0.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: flattened draw data (io.ConfigFlattenDrawData, ImDrawData::FlattenInto())
+//-----------------------------------------------------------------------------
+
+static const int BENCH_FLATTEN_WINDOWS = 544;
+
+// Small windows in a grid filling the screen, producing many small draw lists
+static void ShowSmallWindow(int window_n)
+{
+    char title[32];
+    ImFormatString(title, IM_ARRAYSIZE(title), "Small %03d", window_n);
+    ImGui::SetNextWindowPos(ImVec2((window_n % 32) * 60.0f, (window_n / 32) * 60.0f), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(58.0f, 58.0f), ImGuiCond_Always);
+    ImGui::Begin(title);
+    ImGui::Text("%03d", window_n);
+    ImGui::End();
+}
+
+// Hash the triangles as a renderer sees them, to compare draw data with different layouts: texture, vertices and the part of
+// the clip rectangle overlapping the triangle bounding box of each triangle (merged commands may use larger clip rectangles).
+static ImU32 BenchHashResolvedDrawData(const ImDrawData* draw_data)
+{
+    ImU32 hash = 0;
+    for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+            if (cmd.UserCallback != NULL)
+                continue;
+            for (unsigned int n = 0; n + 3 <= cmd.ElemCount; n += 3)
+            {
+                const ImDrawIdx* idx = &draw_list->IdxBuffer[(int)(cmd.IdxOffset + n)];
+                ImDrawVert vtx[3];
+                ImRect bb;
+                for (int vtx_n = 0; vtx_n < 3; vtx_n++)
+                {
+                    vtx[vtx_n] = draw_list->VtxBuffer[(int)(cmd.VtxOffset + idx[vtx_n])];
+                    bb.Add(vtx[vtx_n].pos);
+                }
+                bb.ClipWithFull(ImRect(cmd.ClipRect));
+                hash = ImHashData(vtx, sizeof(vtx), hash);
+                hash = ImHashData(&bb, sizeof(bb), hash);
+                hash = ImHashData(&cmd.TextureId, sizeof(cmd.TextureId), hash);
+            }
+        }
+    }
+    return hash;
+}
+
+static void Bench_Flatten()
+{
+    // 544 small windows uploaded list by list (2 uploads per draw list), or flattened into a single vertex/index buffer by Render()
+    // (io.ConfigFlattenDrawData, with 1 or 4 threads) or after Render() without rebasing indices (ImDrawData::FlattenInto()).
+    // Uploads are simulated by copying the buffers into staging memory. 'render_ns' includes the flattening done by Render().
+    // The 'merge' cases also merge draw commands (io.ConfigMergeDrawCmds), across windows when flattened.
+    enum { Mode_PerList, Mode_Render, Mode_Helper };
+    struct FlattenCase { const char* Name; int Mode; int Threads; bool Merge; };
+    static const FlattenCase cases[] =
+    {
+        { "per_list",           Mode_PerList,   1,  false },
+        { "flatten",            Mode_Render,    1,  false },
+        { "flatten_threads=4",  Mode_Render,    4,  false },
+        { "flatten_no_rebase",  Mode_Helper,    1,  false },
+        { "merge",              Mode_PerList,   1,  true },
+        { "flatten_merge",      Mode_Render,    1,  true },
+    };
+    ImU32 hash_ref = 0;
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        const FlattenCase& bench_case = cases[case_n];
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+        unsigned char* tex_pixels = NULL;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+        BenchThreadPool thread_pool(bench_case.Threads);
+        io.ConfigFlattenDrawData = (bench_case.Mode == Mode_Render);
+        io.ConfigMergeDrawCmds = bench_case.Merge;
+        io.ParallelForFn = (bench_case.Threads > 1) ? BenchThreadPool::ParallelFor : NULL;
+        io.ParallelForUserData = &thread_pool;
+
+        ImDrawList* flattened = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+        ImVector<char> staging_vtx, staging_idx;
+        double render_ns = 0.0, upload_ns = 0.0, upload_calls = 0.0, draw_calls = 0.0;
+        int frames_count = 0, segments_count = 1;
+        ImU32 hash = 0;
+        for (int frame_n = 0; frame_n < BENCH_WARMUP_FRAMES + GBenchFramesCount; frame_n++)
+        {
+            ImGui::NewFrame();
+            for (int window_n = 0; window_n < BENCH_FLATTEN_WINDOWS; window_n++)
+                ShowSmallWindow(window_n);
+            double t0 = GetTimeNs();
+            ImGui::Render();
+            double t1 = GetTimeNs();
+            ImDrawData* draw_data = ImGui::GetDrawData();
+            ImDrawData flattened_draw_data = *draw_data;
+            if (bench_case.Mode == Mode_Helper)
+            {
+                segments_count = draw_data->FlattenInto(flattened, false);
+                flattened_draw_data.CmdLists = &flattened;
+                flattened_draw_data.CmdListsCount = 1;
+            }
+            for (int list_n = 0; list_n < flattened_draw_data.CmdListsCount; list_n++)
+            {
+                const ImDrawList* draw_list = flattened_draw_data.CmdLists[list_n];
+                staging_vtx.resize(draw_list->VtxBuffer.size_in_bytes());
+                staging_idx.resize(draw_list->IdxBuffer.size_in_bytes());
+                memcpy(staging_vtx.Data, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+                memcpy(staging_idx.Data, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+                GBenchSink += (ImU32)staging_vtx.Data[0] + (ImU32)staging_idx.Data[0];
+            }
+            double t2 = GetTimeNs();
+            if (frame_n < BENCH_WARMUP_FRAMES)
+                continue;
+            frames_count++;
+            render_ns += t1 - t0;
+            upload_ns += t2 - t1;
+            upload_calls += flattened_draw_data.CmdListsCount * 2;
+            for (int list_n = 0; list_n < flattened_draw_data.CmdListsCount; list_n++)
+                for (int cmd_n = 0; cmd_n < flattened_draw_data.CmdLists[list_n]->CmdBuffer.Size; cmd_n++)
+                    draw_calls += (flattened_draw_data.CmdLists[list_n]->CmdBuffer[cmd_n].ElemCount > 0) ? 1.0 : 0.0;
+            if (bench_case.Mode == Mode_Render)
+                segments_count = ctx->FlattenedSegmentsCount;
+            if (frame_n + 1 == BENCH_WARMUP_FRAMES + GBenchFramesCount)
+                hash = BenchHashResolvedDrawData(&flattened_draw_data);
+        }
+        IM_DELETE(flattened);
+        ImGui::DestroyContext(ctx);
+        if (case_n == 0)
+            hash_ref = hash;
+
+        BenchReport("flatten", bench_case.Name, "render_ns", render_ns / frames_count);
+        BenchReport("flatten", bench_case.Name, "upload_ns", upload_ns / frames_count);
+        BenchReport("flatten", bench_case.Name, "render_upload_ns", (render_ns + upload_ns) / frames_count);
+        BenchReport("flatten", bench_case.Name, "upload_calls_per_frame", upload_calls / frames_count);
+        BenchReport("flatten", bench_case.Name, "draw_calls_per_frame", draw_calls / frames_count);
+        BenchReport("flatten", bench_case.Name, "vtx_offsets", (double)segments_count);
+        BenchReport("flatten", bench_case.Name, "output_identical", hash == hash_ref ? 1.0 : 0.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: occlusion culling (io.ConfigOcclusionCulling)
+//-----------------------------------------------------------------------------
+
+static const int BENCH_OCCLUSION_STACKS = 16;
+static const int BENCH_OCCLUSION_STACK_DEPTH = 8;
+
+// Windows stacked on top of each other in a 4x4 grid, like tabs of a docked layout: only the front-most window of each stack is visible
+static void ShowStackedWindow(int stack_n, int depth_n, int frame_n)
+{
+    char title[32];
+    ImFormatString(title, IM_ARRAYSIZE(title), "Stack %02d/%d", stack_n, depth_n);
+    ImGui::SetNextWindowPos(ImVec2((stack_n % 4) * 480.0f + 5.0f, (stack_n / 4) * 270.0f + 5.0f), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(470.0f, 260.0f), ImGuiCond_Always);
+    ImGui::Begin(title);
+    float values[64];
+    for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+        values[n] = ImSin((n + frame_n) * 0.1f + stack_n + depth_n);
+    ImGui::PlotLines("##lines", values, IM_ARRAYSIZE(values), 0, NULL, -1.0f, 1.0f, ImVec2(-1.0f, 60.0f));
+    for (int line_n = 0; line_n < 8; line_n++)
+        ImGui::Text("Stack %d, window %d, line %d: %d", stack_n, depth_n, line_n, frame_n);
+    ImGui::End();
+}
+
+static void Bench_Occlusion()
+{
+    // 16 stacks of 8 windows, with an opaque window background and no rounding (the default style uses a slightly translucent background,
+    // which never hides anything, and the rounded corners of windows show what is behind them).
+    // Uploads are simulated by copying the buffers into staging memory.
+    // 'render_ns' includes gathering occluders and testing draw lists in Render().
+    struct OcclusionCase { const char* Name; bool Culling; };
+    static const OcclusionCase cases[] =
+    {
+        { "off",    false },
+        { "on",     true },
+    };
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        const OcclusionCase& bench_case = cases[case_n];
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        unsigned char* tex_pixels = NULL;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+        io.ConfigOcclusionCulling = bench_case.Culling;
+        ImGui::GetStyle().Colors[ImGuiCol_WindowBg].w = 1.0f;
+        ImGui::GetStyle().WindowRounding = 0.0f;
+
+        ImVector<char> staging_vtx, staging_idx;
+        double render_ns = 0.0, upload_ns = 0.0, draw_lists = 0.0, vertices = 0.0, culled_lists = 0.0;
+        int frames_count = 0;
+        for (int frame_n = 0; frame_n < BENCH_WARMUP_FRAMES + GBenchFramesCount; frame_n++)
+        {
+            ImGui::NewFrame();
+            for (int stack_n = 0; stack_n < BENCH_OCCLUSION_STACKS; stack_n++)
+                for (int depth_n = 0; depth_n < BENCH_OCCLUSION_STACK_DEPTH; depth_n++)
+                    ShowStackedWindow(stack_n, depth_n, frame_n);
+            double t0 = GetTimeNs();
+            ImGui::Render();
+            double t1 = GetTimeNs();
+            ImDrawData* draw_data = ImGui::GetDrawData();
+            for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+            {
+                const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+                staging_vtx.resize(draw_list->VtxBuffer.size_in_bytes());
+                staging_idx.resize(draw_list->IdxBuffer.size_in_bytes());
+                memcpy(staging_vtx.Data, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+                memcpy(staging_idx.Data, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+                GBenchSink += (ImU32)staging_vtx.Data[0] + (ImU32)staging_idx.Data[0];
+            }
+            double t2 = GetTimeNs();
+            if (frame_n < BENCH_WARMUP_FRAMES)
+                continue;
+            frames_count++;
+            render_ns += t1 - t0;
+            upload_ns += t2 - t1;
+            draw_lists += draw_data->CmdListsCount;
+            vertices += draw_data->TotalVtxCount;
+            culled_lists += ctx->OcclusionCulledRects.Size;
+        }
+        ImGui::DestroyContext(ctx);
+
+        BenchReport("occlusion", bench_case.Name, "render_ns", render_ns / frames_count);
+        BenchReport("occlusion", bench_case.Name, "upload_ns", upload_ns / frames_count);
+        BenchReport("occlusion", bench_case.Name, "render_upload_ns", (render_ns + upload_ns) / frames_count);
+        BenchReport("occlusion", bench_case.Name, "draw_lists_per_frame", draw_lists / frames_count);
+        BenchReport("occlusion", bench_case.Name, "culled_lists_per_frame", culled_lists / frames_count);
+        BenchReport("occlusion", bench_case.Name, "vertices_per_frame", vertices / frames_count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: vertex format (IMGUI_USE_COMPACT_DRAWVERT)
+//-----------------------------------------------------------------------------
+
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+// Minimal software rasterizer, to compare the visual output of different vertex formats: 8-bit RGB framebuffer, pixel centers sampling with
+// a top-left fill rule, scissor rectangles cast to int like imgui_impl_opengl3.cpp, nearest texture sampling and standard alpha blending.
+static void BenchRasterizeDrawData(const ImDrawData* draw_data, const unsigned char* tex_pixels, int tex_w, int tex_h, int fb_w, int fb_h, ImVector<unsigned char>& fb)
+{
+    fb.resize(fb_w * fb_h * 3);
+    memset(fb.Data, 0x40, (size_t)fb.Size);
+    for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+            if (cmd.UserCallback != NULL)
+                continue;
+            const int clip_x0 = ImMax((int)cmd.ClipRect.x, 0), clip_x1 = ImMin((int)cmd.ClipRect.x + (int)(cmd.ClipRect.z - cmd.ClipRect.x), fb_w);
+            const int clip_y0 = ImMax((int)cmd.ClipRect.y, 0), clip_y1 = ImMin((int)cmd.ClipRect.y + (int)(cmd.ClipRect.w - cmd.ClipRect.y), fb_h);
+            for (unsigned int n = 0; n + 3 <= cmd.ElemCount; n += 3)
+            {
+                ImVec2 pos[3], uv[3];
+                float col[3][4];
+                for (int vtx_n = 0; vtx_n < 3; vtx_n++)
+                {
+                    const ImDrawVert& vtx = draw_list->VtxBuffer[(int)(cmd.VtxOffset + draw_list->IdxBuffer[(int)(cmd.IdxOffset + n + vtx_n)])];
+                    pos[vtx_n] = vtx.pos;
+                    uv[vtx_n] = vtx.uv;
+                    for (int channel_n = 0; channel_n < 4; channel_n++)
+                        col[vtx_n][channel_n] = ((vtx.col >> (channel_n * 8)) & 0xFF) / 255.0f;
+                }
+                float area = (pos[1].x - pos[0].x) * (pos[2].y - pos[0].y) - (pos[2].x - pos[0].x) * (pos[1].y - pos[0].y);
+                if (area == 0.0f)
+                    continue;
+                if (area < 0.0f)
+                {
+                    ImSwap(pos[1], pos[2]);
+                    ImSwap(uv[1], uv[2]);
+                    for (int channel_n = 0; channel_n < 4; channel_n++)
+                        ImSwap(col[1][channel_n], col[2][channel_n]);
+                    area = -area;
+                }
+                const int x0 = ImMax(clip_x0, (int)ImFloor(ImMin(pos[0].x, ImMin(pos[1].x, pos[2].x)))), x1 = ImMin(clip_x1, (int)ImMax(pos[0].x, ImMax(pos[1].x, pos[2].x)) + 1);
+                const int y0 = ImMax(clip_y0, (int)ImFloor(ImMin(pos[0].y, ImMin(pos[1].y, pos[2].y)))), y1 = ImMin(clip_y1, (int)ImMax(pos[0].y, ImMax(pos[1].y, pos[2].y)) + 1);
+                for (int y = y0; y < y1; y++)
+                    for (int x = x0; x < x1; x++)
+                    {
+                        // Barycentric coordinates of the pixel center, pixels exactly on an edge belong to the triangle on its right or below it
+                        const ImVec2 p(x + 0.5f, y + 0.5f);
+                        float w[3];
+                        bool inside = true;
+                        for (int vtx_n = 0; vtx_n < 3 && inside; vtx_n++)
+                        {
+                            const ImVec2& a = pos[(vtx_n + 1) % 3];
+                            const ImVec2& b = pos[(vtx_n + 2) % 3];
+                            const float e = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+                            inside = (e > 0.0f) || (e == 0.0f && (b.y < a.y || (b.y == a.y && b.x > a.x)));
+                            w[vtx_n] = e / area;
+                        }
+                        if (!inside)
+                            continue;
+                        const ImVec2 tex_uv = uv[0] * w[0] + uv[1] * w[1] + uv[2] * w[2];
+                        const unsigned char* texel = tex_pixels + (ImClamp((int)(tex_uv.y * tex_h), 0, tex_h - 1) * tex_w + ImClamp((int)(tex_uv.x * tex_w), 0, tex_w - 1)) * 4;
+                        float src[4];
+                        for (int channel_n = 0; channel_n < 4; channel_n++)
+                            src[channel_n] = (int)((col[0][channel_n] * w[0] + col[1][channel_n] * w[1] + col[2][channel_n] * w[2]) * 255.0f + 0.5f) / 255.0f * (texel[channel_n] / 255.0f);
+                        unsigned char* dst = &fb[(y * fb_w + x) * 3];
+                        for (int channel_n = 0; channel_n < 3; channel_n++)
+                            dst[channel_n] = (unsigned char)ImClamp((int)((src[channel_n] * src[3] + dst[channel_n] / 255.0f * (1.0f - src[3])) * 255.0f + 0.5f), 0, 255);
+                    }
+            }
+        }
+    }
+}
+
+// Round positions and texture coordinates like the compact vertex layout does (see ImDrawVertPos16::Pack() and ImDrawVertUV16::Pack() in imgui.h)
+static float BenchQuantizePos(float v)  { return (ImClamp((int)(v * 4.0f + 32768.5f), 0, 65535) - 32768) * (1.0f / 4.0f); }
+static float BenchQuantizeUV(float v)   { return ImClamp((int)(v * 65535.0f + 0.5f), 0, 65535) * (1.0f / 65535.0f); }
+static void BenchQuantizeDrawData(ImDrawData* draw_data)
+{
+    for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+        for (int vtx_n = 0; vtx_n < draw_data->CmdLists[list_n]->VtxBuffer.Size; vtx_n++)
+        {
+            ImDrawVert& vtx = draw_data->CmdLists[list_n]->VtxBuffer[vtx_n];
+            vtx.pos = ImVec2(BenchQuantizePos(vtx.pos.x), BenchQuantizePos(vtx.pos.y));
+            vtx.uv = ImVec2(BenchQuantizeUV(vtx.uv.x), BenchQuantizeUV(vtx.uv.y));
+        }
+}
+#endif
+
+static void Bench_VtxFormat()
+{
+    // ShowDemoWindow() + 24 stress windows with the vertex layout of this build (build with -DIMGUI_USE_COMPACT_DRAWVERT to compare).
+    // Uploads are simulated by copying the buffers into staging memory. 'ns_per_frame' includes the conversion of vertices written by ImDrawList.
+    // With the default layout, the last frame is also rasterized with its vertices rounded like the compact layout does,
+    // and compared to the original output: 'psnr_db' is capped to 100 dB (identical images).
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const char* case_name = "compact";
+#else
+    const char* case_name = "float";
+#endif
+    const BenchFramesCase& bench_case = GBenchFramesCases[2];
+    memset(&GStressWindowsState, 0, sizeof(GStressWindowsState));
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    for (int key_n = 0; key_n < ImGuiKey_COUNT; key_n++)
+        io.KeyMap[key_n] = key_n;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    ImVector<char> staging_vtx, staging_idx;
+    double frame_ns = 0.0, upload_ns = 0.0, vtx_bytes = 0.0, idx_bytes = 0.0;
+    int frames_count = 0;
+    for (int frame_n = 0; frame_n < BENCH_WARMUP_FRAMES + GBenchFramesCount; frame_n++)
+    {
+        BenchScriptInputs(io, frame_n);
+        double t0 = GetTimeNs();
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow();
+        for (int window_n = 0; window_n < bench_case.StressWindows; window_n++)
+            ShowStressWindow(window_n, frame_n, bench_case.StressWindowsFlags);
+        ImGui::Render();
+        if (frame_n == 0)
+            BenchExpandDemoWindow();
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        double t1 = GetTimeNs();
+        for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+            staging_vtx.resize(draw_list->VtxBuffer.size_in_bytes());
+            staging_idx.resize(draw_list->IdxBuffer.size_in_bytes());
+            memcpy(staging_vtx.Data, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+            memcpy(staging_idx.Data, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+            GBenchSink += (ImU32)staging_vtx.Data[0] + (ImU32)staging_idx.Data[0];
+        }
+        double t2 = GetTimeNs();
+        if (frame_n < BENCH_WARMUP_FRAMES)
+            continue;
+        frames_count++;
+        frame_ns += t1 - t0;
+        upload_ns += t2 - t1;
+        vtx_bytes += (double)draw_data->TotalVtxCount * sizeof(ImDrawVert);
+        idx_bytes += (double)draw_data->TotalIdxCount * sizeof(ImDrawIdx);
+    }
+    BenchReport("vtxformat", case_name, "bytes_per_vertex", (double)sizeof(ImDrawVert));
+    BenchReport("vtxformat", case_name, "vtx_bytes_per_frame", vtx_bytes / frames_count);
+    BenchReport("vtxformat", case_name, "upload_bytes_per_frame", (vtx_bytes + idx_bytes) / frames_count);
+    BenchReport("vtxformat", case_name, "upload_ns", upload_ns / frames_count);
+    BenchReport("vtxformat", case_name, "ns_per_frame", frame_ns / frames_count);
+
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    const int fb_w = (int)io.DisplaySize.x, fb_h = (int)io.DisplaySize.y;
+    ImVector<unsigned char> fb_ref, fb_quantized;
+    BenchRasterizeDrawData(draw_data, tex_pixels, tex_w, tex_h, fb_w, fb_h, fb_ref);
+    BenchQuantizeDrawData(draw_data);
+    BenchRasterizeDrawData(draw_data, tex_pixels, tex_w, tex_h, fb_w, fb_h, fb_quantized);
+    int diff_pixels = 0, diff_max = 0;
+    double diff_sq_sum = 0.0;
+    for (int n = 0; n < fb_ref.Size; n += 3)
+    {
+        bool diff_pixel = false;
+        for (int channel_n = 0; channel_n < 3; channel_n++)
+        {
+            const int diff = abs((int)fb_ref[n + channel_n] - (int)fb_quantized[n + channel_n]);
+            diff_pixel |= (diff != 0);
+            diff_max = ImMax(diff_max, diff);
+            diff_sq_sum += (double)(diff * diff);
+        }
+        diff_pixels += diff_pixel ? 1 : 0;
+    }
+    const double mse = diff_sq_sum / fb_ref.Size;
+    BenchReport("vtxformat", "quantized", "differing_pixels", (double)diff_pixels);
+    BenchReport("vtxformat", "quantized", "differing_pixels_percent", 100.0 * diff_pixels / (fb_w * fb_h));
+    BenchReport("vtxformat", "quantized", "max_channel_diff", (double)diff_max);
+    BenchReport("vtxformat", "quantized", "psnr_db", (mse > 0.0) ? ImMin(100.0, 10.0 * log10(255.0 * 255.0 / mse)) : 100.0);
+#endif
+    ImGui::DestroyContext(ctx);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: compaction of unused windows memory (io.ConfigWindowsMemoryCompactTimer)
+//-----------------------------------------------------------------------------
+
+static void Bench_WindowsGC()
+{
+    // 24 stress windows and a tooltip are shown for 1 second, then hidden for 3 seconds (only a small window is shown), then shown again for 1 second.
+    // 'peak_kb' is the highest memory used by windows, 'steady_kb' the memory used at the end of the hidden period (with a 1 second compaction timer
+    // in the 'on' cases). 'awake_frame_ns' is the duration of the frame where windows are shown again, which reallocates their buffers.
+    // 'output_identical' compares the last frame with the case without compaction using the same window flags.
+    struct WindowsGCCase { const char* Name; float CompactTimer; ImGuiWindowFlags Flags; };
+    static const WindowsGCCase cases[] =
+    {
+        { "off",            -1.0f,  ImGuiWindowFlags_None },
+        { "on",             1.0f,   ImGuiWindowFlags_None },
+        { "off_retained",   -1.0f,  ImGuiWindowFlags_RetainDrawList },
+        { "on_retained",    1.0f,   ImGuiWindowFlags_RetainDrawList },
+    };
+    const int shown_frames = 60, hidden_frames = 180;
+    ImU32 hash_ref = 0;
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        const WindowsGCCase& bench_case = cases[case_n];
+        memset(&GStressWindowsState, 0, sizeof(GStressWindowsState));
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.ConfigWindowsMemoryCompactTimer = bench_case.CompactTimer;
+        unsigned char* tex_pixels = NULL;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+        double steady_kb = 0.0, awake_frame_ns = 0.0;
+        int steady_allocs = 0, compacted_count = 0;
+        ImU32 hash = 0;
+        for (int frame_n = 0; frame_n < shown_frames * 2 + hidden_frames; frame_n++)
+        {
+            const bool show_windows = (frame_n < shown_frames || frame_n >= shown_frames + hidden_frames);
+            double t0 = GetTimeNs();
+            ImGui::NewFrame();
+            ImGui::Begin("Main");
+            ImGui::Text("Frame %d", frame_n);
+            ImGui::End();
+            if (show_windows)
+            {
+                for (int window_n = 0; window_n < 24; window_n++)
+                    ShowStressWindow(window_n, frame_n, bench_case.Flags);
+                ImGui::SetTooltip("Tooltip, frame %d", frame_n);
+            }
+            ImGui::Render();
+            double t1 = GetTimeNs();
+            if (frame_n == shown_frames + hidden_frames - 1)
+            {
+                steady_kb = ctx->WindowsMemoryUsage / 1024.0;
+                steady_allocs = io.MetricsActiveAllocations;
+                compacted_count = ctx->WindowsMemoryCompactedCount;
+            }
+            if (frame_n == shown_frames + hidden_frames)
+                awake_frame_ns = t1 - t0;
+        }
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+            hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+            hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+        }
+        if (bench_case.CompactTimer < 0.0f)
+            hash_ref = hash;
+
+        BenchReport("windows_gc", bench_case.Name, "peak_kb", ctx->WindowsMemoryUsagePeak / 1024.0);
+        BenchReport("windows_gc", bench_case.Name, "steady_kb", steady_kb);
+        BenchReport("windows_gc", bench_case.Name, "steady_active_allocations", (double)steady_allocs);
+        BenchReport("windows_gc", bench_case.Name, "compacted_windows", (double)compacted_count);
+        BenchReport("windows_gc", bench_case.Name, "awake_frame_ns", awake_frame_ns);
+        BenchReport("windows_gc", bench_case.Name, "output_identical", hash == hash_ref ? 1.0 : 0.0);
+        ImGui::DestroyContext(ctx);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: steady-state allocations (g.AllocAuditMode, g.AllocReserveHeadroom)
+//-----------------------------------------------------------------------------
+
+static void Bench_AllocAudit()
+{
+    // Run the 'frames' cases with the allocation audit enabled: 10 seconds of warm-up with scripted inputs, then measured frames
+    // which should never allocate. 'allocs_after_warmup' is counted by the audit, 'allocator_calls_after_warmup' by our allocator
+    // functions, starting from the second measured frame since the first NewFrame() applies the pre-reservation hint (counted as warm-up).
+    // The 'no_headroom' cases disable that hint. Note that the scripted inputs keep reaching new contents in much longer runs (e.g. the first
+    // scroll revealing the columns of a stress window after ~30 seconds), which the audit reports as it should.
+    const int warmup_frames = 600;
+    for (int headroom_n = 0; headroom_n < 2; headroom_n++)
+        for (int case_n = 0; case_n < IM_ARRAYSIZE(GBenchFramesCases); case_n++)
+        {
+            const BenchFramesCase& bench_case = GBenchFramesCases[case_n];
+            char case_name[64];
+            ImFormatString(case_name, IM_ARRAYSIZE(case_name), "%s%s", bench_case.Name, headroom_n == 0 ? "_no_headroom" : "");
+            memset(&GStressWindowsState, 0, sizeof(GStressWindowsState));
+            ImGuiContext* ctx = ImGui::CreateContext();
+            ImGuiIO& io = ImGui::GetIO();
+            io.IniFilename = NULL;
+            io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+            io.DeltaTime = 1.0f / 60.0f;
+            for (int key_n = 0; key_n < ImGuiKey_COUNT; key_n++)
+                io.KeyMap[key_n] = key_n;
+            unsigned char* tex_pixels = NULL;
+            int tex_w, tex_h;
+            io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+            ctx->AllocAuditMode = ImGuiAllocAuditMode_Record;
+            ctx->AllocAuditWarmupFrames = warmup_frames;
+            if (headroom_n == 0)
+                ctx->AllocReserveHeadroom = 0.0f;
+
+            int alloc_count_start = 0;
+            for (int frame_n = 0; frame_n < warmup_frames + GBenchFramesCount; frame_n++)
+            {
+                BenchScriptInputs(io, frame_n);
+                if (frame_n == warmup_frames + 1)
+                    alloc_count_start = GBenchAllocCount;
+                ImGui::NewFrame();
+                if (bench_case.ShowDemoWindow)
+                    ImGui::ShowDemoWindow();
+                for (int window_n = 0; window_n < bench_case.StressWindows; window_n++)
+                    ShowStressWindow(window_n, bench_case.StressWindowsAnimated ? frame_n : 0, bench_case.StressWindowsFlags);
+                ImGui::Render();
+                if (frame_n == 0 && bench_case.ShowDemoWindow)
+                    BenchExpandDemoWindow();
+            }
+            BenchReport("allocaudit", case_name, "warmup_allocs", (double)ctx->AllocAuditWarmupAllocsCount);
+            BenchReport("allocaudit", case_name, "warmup_kb", ctx->AllocAuditWarmupAllocsBytes / 1024.0);
+            BenchReport("allocaudit", case_name, "high_water_mark", (double)ctx->AllocAuditHighWaterMark);
+            BenchReport("allocaudit", case_name, "allocs_after_warmup", (double)ctx->AllocAuditViolationsCount);
+            BenchReport("allocaudit", case_name, "allocator_calls_after_warmup", (double)(GBenchAllocCount - alloc_count_start));
+            ImGui::DestroyContext(ctx);
+        }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: frame arena (g.FrameArena)
+//-----------------------------------------------------------------------------
+
+static void ShowTabsLongTextWindow(int frame_n, const char* long_text, ImVec2* out_formatted_size, ImVec2* out_unformatted_size)
+{
+    ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(600.0f, 400.0f), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Tabs and long text", NULL, ImGuiWindowFlags_HorizontalScrollbar);
+    if (ImGui::BeginTabBar("tabs", ImGuiTabBarFlags_FittingPolicyResizeDown))
+    {
+        for (int tab_n = 0; tab_n < 40; tab_n++)
+        {
+            char label[32];
+            ImFormatString(label, IM_ARRAYSIZE(label), "Tab %d", tab_n);
+            if (ImGui::BeginTabItem(label))
+            {
+                ImGui::Text("Contents of tab %d, frame %d", tab_n, frame_n);
+                ImGui::EndTabItem();
+            }
+        }
+        ImGui::EndTabBar();
+    }
+    ImGui::Text("%s", long_text);
+    *out_formatted_size = ImGui::GetItemRectSize();
+    ImGui::TextUnformatted(long_text);
+    *out_unformatted_size = ImGui::GetItemRectSize();
+    ImGui::End();
+}
+
+static void Bench_FrameArena()
+{
+    // Per-frame arena usage, to size it. 'arena_overflow_allocs' counts arena allocations which didn't fit in its block after warm-up
+    // and 'heap_allocs' all allocator calls after warm-up. 'long_text_untruncated' checks that text formatted beyond g.TempBuffer
+    // (5000 characters in 50 lines) is displayed entirely: its height matches the same text displayed with TextUnformatted().
+    // (Text() doesn't calculate the width of large text)
+    static char long_text[5001];
+    for (int n = 0; n < IM_ARRAYSIZE(long_text) - 1; n++)
+        long_text[n] = (n % 100 == 99) ? '\n' : (char)('a' + n % 26);
+    long_text[IM_ARRAYSIZE(long_text) - 1] = 0;
+
+    for (int case_n = 0; case_n < 2; case_n++)
+    {
+        const char* case_name = (case_n == 0) ? "demo_stress" : "tabs_long_text";
+        memset(&GStressWindowsState, 0, sizeof(GStressWindowsState));
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        unsigned char* tex_pixels = NULL;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+        double used_bytes = 0.0, allocs = 0.0;
+        int overflow_allocs = 0, alloc_count_start = 0;
+        bool untruncated = true;
+        for (int frame_n = 0; frame_n < BENCH_WARMUP_FRAMES + GBenchFramesCount; frame_n++)
+        {
+            BenchScriptInputs(io, frame_n);
+            if (frame_n == BENCH_WARMUP_FRAMES)
+                alloc_count_start = GBenchAllocCount;
+            ImGui::NewFrame();
+            if (frame_n > BENCH_WARMUP_FRAMES)
+            {
+                // Stats of the previous frame, latched by NewFrame()
+                used_bytes += ctx->FrameArena.LastUsedBytes;
+                allocs += ctx->FrameArena.LastAllocsCount;
+                overflow_allocs += ctx->FrameArena.LastOverflowCount;
+            }
+            if (case_n == 0)
+            {
+                ImGui::ShowDemoWindow();
+                for (int window_n = 0; window_n < 24; window_n++)
+                    ShowStressWindow(window_n, frame_n, ImGuiWindowFlags_None);
+            }
+            else
+            {
+                ImVec2 formatted_size, unformatted_size;
+                ShowTabsLongTextWindow(frame_n, long_text, &formatted_size, &unformatted_size);
+                untruncated &= (formatted_size.y == unformatted_size.y);
+            }
+            ImGui::Render();
+            if (frame_n == 0 && case_n == 0)
+                BenchExpandDemoWindow();
+        }
+        const double frames = (double)ImMax(1, GBenchFramesCount - 1);
+        BenchReport("arena", case_name, "arena_bytes_per_frame", used_bytes / frames);
+        BenchReport("arena", case_name, "arena_allocs_per_frame", allocs / frames);
+        BenchReport("arena", case_name, "arena_peak_bytes", (double)ctx->FrameArena.PeakUsedBytes);
+        BenchReport("arena", case_name, "arena_block_bytes", (double)ctx->FrameArena.BlockSize);
+        BenchReport("arena", case_name, "arena_overflow_allocs", (double)overflow_allocs);
+        BenchReport("arena", case_name, "heap_allocs", (double)(GBenchAllocCount - alloc_count_start));
+        if (case_n == 1)
+            BenchReport("arena", case_name, "long_text_untruncated", untruncated ? 1.0 : 0.0);
+        ImGui::DestroyContext(ctx);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: memory accounting (g.MemoryTagsEnabled)
+//-----------------------------------------------------------------------------
+
+static void ShowGrowingStorageWindow(int frame_n)
+{
+    // Store state for new IDs every frame, like a panel keeping the open state of an ever growing list of tree nodes
+    ImGui::SetNextWindowPos(ImVec2(1500.0f, 20.0f), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Growing storage");
+    ImGui::Text("Frame %d", frame_n);
+    for (int n = 0; n < 256; n++)
+        ImGui::GetStateStorage()->SetInt(ImGui::GetID((void*)(intptr_t)(frame_n * 256 + n)), 1);
+    ImGui::End();
+}
+
+static void Bench_MemoryTags()
+{
+    // Demo + 24 stress windows + a window growing its storage every frame, with and without tracking (enabled before building
+    // the font atlas). Live/peak KB per subsystem are measured after the last frame. 'untracked_allocs' counts the active allocations
+    // made before tracking was enabled (by CreateContext()), 'windows_bytes_match' checks that the bytes attributed to windows match
+    // GcCalcWindowMemoryUsage() every frame, and 'growing_window_first' that the growing window tops the Metrics list of windows by tracked memory.
+    for (int case_n = 0; case_n < 2; case_n++)
+    {
+        const bool tracking = (case_n == 1);
+        const char* case_name = tracking ? "on" : "off";
+        memset(&GStressWindowsState, 0, sizeof(GStressWindowsState));
+        ImGuiContext* ctx = ImGui::CreateContext();
+        ctx->MemoryTagsEnabled = tracking;
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        unsigned char* tex_pixels = NULL;
+        int tex_w, tex_h;
+        io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+        double frames_ns = 0.0;
+        bool windows_bytes_match = true;
+        for (int frame_n = 0; frame_n < BENCH_WARMUP_FRAMES + GBenchFramesCount; frame_n++)
+        {
+            BenchScriptInputs(io, frame_n);
+            double t0 = GetTimeNs();
+            ImGui::NewFrame();
+            if (tracking && frame_n > 0)
+            {
+                // Both are updated by NewFrame()
+                int tagged_bytes = 0;
+                for (int window_n = 0; window_n < ctx->Windows.Size; window_n++)
+                    for (int tag = 0; tag < ImGuiMemoryTag_COUNT; tag++)
+                        tagged_bytes += ctx->Windows[window_n]->MemoryTagsBytes[tag];
+                windows_bytes_match &= (tagged_bytes == ctx->WindowsMemoryUsage);
+            }
+            ImGui::ShowDemoWindow();
+            for (int window_n = 0; window_n < 24; window_n++)
+                ShowStressWindow(window_n, frame_n, ImGuiWindowFlags_None);
+            ShowGrowingStorageWindow(frame_n);
+            ImGui::Render();
+            double t1 = GetTimeNs();
+            if (frame_n == 0)
+                BenchExpandDemoWindow();
+            if (frame_n >= BENCH_WARMUP_FRAMES)
+                frames_ns += t1 - t0;
+        }
+        BenchReport("memtags", case_name, "ns_per_frame", frames_ns / ImMax(1, GBenchFramesCount));
+        if (tracking)
+        {
+            // Attribute the allocations of the last frame
+            ImGui::NewFrame();
+            ImGui::EndFrame();
+            for (int tag = 0; tag < ImGuiMemoryTag_COUNT; tag++)
+            {
+                char metric[64];
+                ImFormatString(metric, IM_ARRAYSIZE(metric), "%s_live_kb", ImGui::MemoryTagGetName(tag));
+                BenchReport("memtags", case_name, metric, ctx->MemoryTagStats[tag].LiveBytes / 1024.0);
+                ImFormatString(metric, IM_ARRAYSIZE(metric), "%s_peak_kb", ImGui::MemoryTagGetName(tag));
+                BenchReport("memtags", case_name, metric, ctx->MemoryTagStats[tag].PeakBytes / 1024.0);
+            }
+            ImGuiWindow* top_window = NULL;
+            int top_window_bytes = 0;
+            for (int window_n = 0; window_n < ctx->Windows.Size; window_n++)
+            {
+                int bytes = 0;
+                for (int tag = 0; tag < ImGuiMemoryTag_COUNT; tag++)
+                    bytes += ctx->Windows[window_n]->MemoryTagsBytes[tag];
+                if (bytes > top_window_bytes)
+                {
+                    top_window = ctx->Windows[window_n];
+                    top_window_bytes = bytes;
+                }
+            }
+            BenchReport("memtags", case_name, "untracked_allocs", (double)(io.MetricsActiveAllocations - ctx->MemoryAllocsCount));
+            BenchReport("memtags", case_name, "windows_bytes_match", windows_bytes_match ? 1.0 : 0.0);
+            BenchReport("memtags", case_name, "growing_window_first", (top_window && strcmp(top_window->Name, "Growing storage") == 0) ? 1.0 : 0.0);
+        }
+        ImGui::DestroyContext(ctx);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
+//-----------------------------------------------------------------------------
+
+static const char* BENCH_DYNATLAS_FONT_FILES[] = { "../fonts/DroidSans.ttf", "../fonts/Roboto-Medium.ttf" };
+static const float BENCH_DYNATLAS_FONT_SIZES[] = { 13.0f, 18.0f, 24.0f };
+static const int   BENCH_DYNATLAS_LINE_GLYPHS = 64;
+
+// Every glyph of DroidSans + Roboto (0x20..0xFFFF) at 3 sizes, from TTF data loaded once
+static void BenchBuildWideAtlas(ImFontAtlas* atlas, void* const* files_data, const size_t* files_size, bool dynamic, int cache_height)
+{
+    static const ImWchar ranges[] = { 0x0020, 0xFFFF, 0 };
+    atlas->Flags = dynamic ? ImFontAtlasFlags_DynamicGlyphs : ImFontAtlasFlags_None;
+    atlas->TexDynamicCacheHeight = cache_height;
+    ImFontConfig cfg;
+    cfg.FontDataOwnedByAtlas = false;
+    for (int file_n = 0; file_n < IM_ARRAYSIZE(BENCH_DYNATLAS_FONT_FILES); file_n++)
+        for (int size_n = 0; size_n < IM_ARRAYSIZE(BENCH_DYNATLAS_FONT_SIZES); size_n++)
+            atlas->AddFontFromMemoryTTF(files_data[file_n], (int)files_size[file_n], BENCH_DYNATLAS_FONT_SIZES[size_n], &cfg, ranges);
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+}
+
+// Draw glyphs [first, first+count) of the font (wrapping around), in lines of BENCH_DYNATLAS_LINE_GLYPHS glyphs
+static void BenchDrawGlyphs(ImFont* font, const ImVector<ImWchar>& codepoints, int first, int count, float* y)
+{
+    ImDrawList* draw_list = ImGui::GetForegroundDrawList();
+    ImWchar line_w[BENCH_DYNATLAS_LINE_GLYPHS];
+    char line[BENCH_DYNATLAS_LINE_GLYPHS * 3 + 1];
+    for (int n = 0; n < count; n += BENCH_DYNATLAS_LINE_GLYPHS)
+    {
+        const int line_count = ImMin(BENCH_DYNATLAS_LINE_GLYPHS, count - n);
+        for (int i = 0; i < line_count; i++)
+            line_w[i] = codepoints[(first + n + i) % codepoints.Size];
+        ImTextStrToUtf8(line, IM_ARRAYSIZE(line), line_w, line_w + line_count);
+        draw_list->AddText(font, font->FontSize, ImVec2(0.0f, *y), IM_COL32_WHITE, line);
+        *y += font->FontSize;
+    }
+}
+
+// Compare positions, colors and indices (UV differ as glyphs are laid out differently in the texture)
+static bool BenchCompareDrawDataGeometry(const ImDrawData* a, const ImDrawData* b)
+{
+    if (a->CmdListsCount != b->CmdListsCount)
+        return false;
+    for (int list_n = 0; list_n < a->CmdListsCount; list_n++)
+    {
+        const ImDrawList* list_a = a->CmdLists[list_n];
+        const ImDrawList* list_b = b->CmdLists[list_n];
+        if (list_a->VtxBuffer.Size != list_b->VtxBuffer.Size || list_a->IdxBuffer.Size != list_b->IdxBuffer.Size)
+            return false;
+        if (memcmp(list_a->IdxBuffer.Data, list_b->IdxBuffer.Data, (size_t)list_a->IdxBuffer.size_in_bytes()) != 0)
+            return false;
+        for (int vtx_n = 0; vtx_n < list_a->VtxBuffer.Size; vtx_n++)
+        {
+            const ImDrawVert& vtx_a = list_a->VtxBuffer[vtx_n];
+            const ImDrawVert& vtx_b = list_b->VtxBuffer[vtx_n];
+            const ImVec2 pos_a = vtx_a.pos, pos_b = vtx_b.pos; // Also with IMGUI_USE_COMPACT_DRAWVERT
+            if (pos_a.x != pos_b.x || pos_a.y != pos_b.y || vtx_a.col != vtx_b.col)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Number of glyphs whose texels differ between the two atlases (glyphs not resident in 'atlas_b' are skipped)
+static int BenchCompareGlyphsPixels(ImFontAtlas* atlas_a, ImFontAtlas* atlas_b)
+{
+    int mismatches = 0;
+    for (int font_n = 0; font_n < atlas_a->Fonts.Size; font_n++)
+    {
+        const ImFont* font_a = atlas_a->Fonts[font_n];
+        const ImFont* font_b = atlas_b->Fonts[font_n];
+        for (int glyph_n = 0; glyph_n < font_a->Glyphs.Size; glyph_n++)
+        {
+            const ImFontGlyph* glyph_a = &font_a->Glyphs[glyph_n];
+            const ImFontGlyph* glyph_b = font_b->FindGlyphNoFallback(glyph_a->Codepoint);
+            if (glyph_b == NULL)
+            {
+                mismatches++;
+                continue;
+            }
+            if (glyph_b->U1 == 0.0f && glyph_a->U1 != 0.0f)
+                continue;
+            const int ax = (int)(glyph_a->U0 * atlas_a->TexWidth + 0.5f), ay = (int)(glyph_a->V0 * atlas_a->TexHeight + 0.5f);
+            const int bx = (int)(glyph_b->U0 * atlas_b->TexWidth + 0.5f), by = (int)(glyph_b->V0 * atlas_b->TexHeight + 0.5f);
+            const int w = (int)(glyph_a->U1 * atlas_a->TexWidth + 0.5f) - ax;
+            const int h = (int)(glyph_a->V1 * atlas_a->TexHeight + 0.5f) - ay;
+            bool match = (w == (int)(glyph_b->U1 * atlas_b->TexWidth + 0.5f) - bx) && (h == (int)(glyph_b->V1 * atlas_b->TexHeight + 0.5f) - by);
+            for (int y = 0; y < h && match; y++)
+                match = memcmp(atlas_a->TexPixelsAlpha8 + ax + (ay + y) * atlas_a->TexWidth, atlas_b->TexPixelsAlpha8 + bx + (by + y) * atlas_b->TexWidth, (size_t)w) == 0;
+            mismatches += match ? 0 : 1;
+        }
+    }
+    return mismatches;
+}
+
+static void Bench_DynamicAtlas()
+{
+    void* files_data[IM_ARRAYSIZE(BENCH_DYNATLAS_FONT_FILES)];
+    size_t files_size[IM_ARRAYSIZE(BENCH_DYNATLAS_FONT_FILES)];
+    for (int file_n = 0; file_n < IM_ARRAYSIZE(BENCH_DYNATLAS_FONT_FILES); file_n++)
+        if ((files_data[file_n] = ImFileLoadToMemory(BENCH_DYNATLAS_FONT_FILES[file_n], "rb", &files_size[file_n])) == NULL)
+        {
+            fprintf(stderr, "Failed to load '%s', run from misc/benchmark/\n", BENCH_DYNATLAS_FONT_FILES[file_n]);
+            exit(1);
+        }
+
+    // Build time and texture size, everything rasterized up front vs ASCII only
+    ImFontAtlas atlas_static, atlas_dynamic;
+    double t0 = GetTimeNs();
+    BenchBuildWideAtlas(&atlas_static, files_data, files_size, false, 0);
+    double t1 = GetTimeNs();
+    BenchBuildWideAtlas(&atlas_dynamic, files_data, files_size, true, 2048);
+    double t2 = GetTimeNs();
+    int glyphs_count = 0;
+    for (int font_n = 0; font_n < atlas_static.Fonts.Size; font_n++)
+        glyphs_count += atlas_static.Fonts[font_n]->Glyphs.Size;
+    BenchReport("dynatlas", "static", "glyphs", (double)glyphs_count);
+    BenchReport("dynatlas", "static", "build_ms", (t1 - t0) / 1000000.0);
+    BenchReport("dynatlas", "static", "tex_kb", atlas_static.TexWidth * atlas_static.TexHeight * 4 / 1024.0);
+    BenchReport("dynatlas", "dynamic", "build_ms", (t2 - t1) / 1000000.0);
+    BenchReport("dynatlas", "dynamic", "tex_kb", atlas_dynamic.TexWidth * atlas_dynamic.TexHeight * 4 / 1024.0);
+
+    // Draw every glyph of every font through both atlases: geometry must be identical and rasterized glyphs byte-identical.
+    // The first frame rasterizes everything on demand, later frames only look glyphs up.
+    ImVector<ImWchar> codepoints[IM_ARRAYSIZE(BENCH_DYNATLAS_FONT_FILES) * IM_ARRAYSIZE(BENCH_DYNATLAS_FONT_SIZES)];
+    for (int font_n = 0; font_n < atlas_static.Fonts.Size; font_n++)
+        for (int glyph_n = 0; glyph_n < atlas_static.Fonts[font_n]->Glyphs.Size; glyph_n++)
+            if (atlas_static.Fonts[font_n]->Glyphs[glyph_n].Codepoint > ' ')
+                codepoints[font_n].push_back(atlas_static.Fonts[font_n]->Glyphs[glyph_n].Codepoint);
+    ImFontAtlas* atlases[2] = { &atlas_static, &atlas_dynamic };
+    ImGuiContext* contexts[2];
+    double frames_ns[2] = { 0.0, 0.0 };
+    double first_frame_ns[2] = { 0.0, 0.0 };
+    bool geometry_match = true;
+    for (int n = 0; n < 2; n++)
+    {
+        contexts[n] = ImGui::CreateContext(atlases[n]);
+        ImGui::SetCurrentContext(contexts[n]);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(4096.0f, 4096.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+    }
+    const int frames_count = ImMin(GBenchFramesCount, 60);
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        for (int n = 0; n < 2; n++)
+        {
+            ImGui::SetCurrentContext(contexts[n]);
+            double t_begin = GetTimeNs();
+            ImGui::NewFrame();
+            float y = 0.0f;
+            for (int font_n = 0; font_n < atlases[n]->Fonts.Size; font_n++)
+                BenchDrawGlyphs(atlases[n]->Fonts[font_n], codepoints[font_n], 0, codepoints[font_n].Size, &y);
+            ImGui::Render();
+            double t_end = GetTimeNs();
+            (frame_n == 0 ? first_frame_ns[n] : frames_ns[n]) += t_end - t_begin;
+        }
+        ImGui::SetCurrentContext(contexts[0]);
+        const ImDrawData* draw_data_static = ImGui::GetDrawData();
+        ImGui::SetCurrentContext(contexts[1]);
+        geometry_match &= BenchCompareDrawDataGeometry(draw_data_static, ImGui::GetDrawData());
+    }
+    for (int n = 0; n < 2; n++)
+    {
+        const char* case_name = (n == 0) ? "static" : "dynamic";
+        BenchReport("dynatlas", case_name, "first_frame_ms", first_frame_ns[n] / 1000000.0);
+        BenchReport("dynatlas", case_name, "ns_per_frame", frames_ns[n] / ImMax(1, frames_count - 1));
+    }
+    BenchReport("dynatlas", "dynamic", "rasterized", (double)atlas_dynamic.DynamicGlyphsRasterizedCount);
+    BenchReport("dynatlas", "dynamic", "overflow", (double)atlas_dynamic.DynamicGlyphsOverflowCount);
+    BenchReport("dynatlas", "dynamic", "geometry_match", geometry_match ? 1.0 : 0.0);
+    BenchReport("dynatlas", "dynamic", "pixels_mismatches", (double)BenchCompareGlyphsPixels(&atlas_static, &atlas_dynamic));
+    for (int n = 0; n < 2; n++)
+        ImGui::DestroyContext(contexts[n]);
+
+    // Churn: a 512 pixels cache while every frame shows 96 glyphs of each font, scrolling by 4 glyphs per frame.
+    // Uploads are measured as the GL3 back-end does them (each dirty rectangle, RGBA).
+    ImFontAtlas atlas_churn;
+    BenchBuildWideAtlas(&atlas_churn, files_data, files_size, true, 512);
+    ImGuiContext* ctx = ImGui::CreateContext(&atlas_churn);
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(4096.0f, 4096.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    double churn_ns = 0.0;
+    double upload_bytes = 0.0;
+    for (int frame_n = 0; frame_n < BENCH_WARMUP_FRAMES + GBenchFramesCount; frame_n++)
+    {
+        if (frame_n == BENCH_WARMUP_FRAMES)
+            atlas_churn.DynamicGlyphsRasterizedCount = atlas_churn.DynamicGlyphsEvictedCount = atlas_churn.DynamicGlyphsOverflowCount = 0;
+        double t_begin = GetTimeNs();
+        ImGui::NewFrame();
+        float y = 0.0f;
+        for (int font_n = 0; font_n < atlas_churn.Fonts.Size; font_n++)
+            BenchDrawGlyphs(atlas_churn.Fonts[font_n], codepoints[font_n], frame_n * 4, 96, &y);
+        ImGui::Render();
+        double t_end = GetTimeNs();
+        if (frame_n >= BENCH_WARMUP_FRAMES)
+        {
+            churn_ns += t_end - t_begin;
+            for (int n = 0; n < atlas_churn.TexDirtyRects.Size; n++)
+            {
+                const ImFontAtlas::TexDirtyRect& rect = atlas_churn.TexDirtyRects[n];
+                upload_bytes += (double)(rect.X1 - rect.X0) * (rect.Y1 - rect.Y0) * 4;
+            }
+        }
+        atlas_churn.ClearTexDirty();
+    }
+    const double frames_div = (double)ImMax(1, GBenchFramesCount);
+    BenchReport("dynatlas", "churn", "ns_per_frame", churn_ns / frames_div);
+    BenchReport("dynatlas", "churn", "rasterized_per_frame", atlas_churn.DynamicGlyphsRasterizedCount / frames_div);
+    BenchReport("dynatlas", "churn", "evicted_per_frame", atlas_churn.DynamicGlyphsEvictedCount / frames_div);
+    BenchReport("dynatlas", "churn", "overflow_per_frame", atlas_churn.DynamicGlyphsOverflowCount / frames_div);
+    BenchReport("dynatlas", "churn", "upload_kb_per_frame", upload_bytes / 1024.0 / frames_div);
+
+    // Text drawn into a list using a CreateDrawListSharedData() copy, as done on other threads, must leave the atlas untouched:
+    // glyphs rasterized on demand are replaced by the fallback glyph, even those currently resident.
+    ImDrawListSharedData* offthread_shared_data = ImGui::CreateDrawListSharedData();
+    ImDrawList offthread_draw_list(offthread_shared_data);
+    offthread_draw_list.PushClipRectFullScreen();
+    offthread_draw_list.PushTextureID(atlas_churn.TexID);
+    const int rasterized_before = atlas_churn.DynamicGlyphsRasterizedCount;
+    const int evicted_before = atlas_churn.DynamicGlyphsEvictedCount;
+    ImVector<ImFontGlyph> glyphs_before;
+    for (int font_n = 0; font_n < atlas_churn.Fonts.Size; font_n++)
+        for (int glyph_n = 0; glyph_n < atlas_churn.Fonts[font_n]->Glyphs.Size; glyph_n++)
+            glyphs_before.push_back(atlas_churn.Fonts[font_n]->Glyphs[glyph_n]);
+    for (int font_n = 0; font_n < atlas_churn.Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas_churn.Fonts[font_n];
+        char buf[5];
+        for (int glyph_n = 0; glyph_n < codepoints[font_n].Size; glyph_n++)
+        {
+            ImTextStrToUtf8(buf, IM_ARRAYSIZE(buf), &codepoints[font_n][glyph_n], &codepoints[font_n][glyph_n] + 1);
+            offthread_draw_list.AddText(font, font->FontSize, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, buf);
+        }
+    }
+    bool offthread_atlas_modified = atlas_churn.DynamicGlyphsRasterizedCount != rasterized_before || atlas_churn.DynamicGlyphsEvictedCount != evicted_before || atlas_churn.IsTexDirty();
+    for (int font_n = 0, glyph_i = 0; font_n < atlas_churn.Fonts.Size; font_n++)
+        for (int glyph_n = 0; glyph_n < atlas_churn.Fonts[font_n]->Glyphs.Size; glyph_n++, glyph_i++)
+            offthread_atlas_modified |= memcmp(&atlas_churn.Fonts[font_n]->Glyphs[glyph_n], &glyphs_before[glyph_i], sizeof(ImFontGlyph)) != 0;
+    BenchReport("dynatlas", "offthread", "atlas_modified", offthread_atlas_modified ? 1.0 : 0.0);
+    offthread_draw_list.ClearFreeMemory();
+    ImGui::DestroyDrawListSharedData(offthread_shared_data);
+    ImGui::DestroyContext(ctx);
+
+    for (int file_n = 0; file_n < IM_ARRAYSIZE(BENCH_DYNATLAS_FONT_FILES); file_n++)
+        IM_FREE(files_data[file_n]);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: parallel font atlas build (ImFontAtlas::ParallelForFn)
+//-----------------------------------------------------------------------------
+
+static const char* BENCH_FONTBUILD_FONT_FILES[] = { "../fonts/DroidSans.ttf", "../fonts/Roboto-Medium.ttf", "../fonts/Cousine-Regular.ttf", "../fonts/Karla-Regular.ttf", "../fonts/ProggyClean.ttf", "../fonts/ProggyTiny.ttf" };
+static const float BENCH_FONTBUILD_FONT_SIZES[] = { 13.0f, 20.0f };
+
+// Every glyph of every bundled font (0x20..0xFFFF) at 2 sizes, loaded from disk as an application would do at startup
+static void BenchAddBundledFonts(ImFontAtlas* atlas)
+{
+    static const ImWchar ranges[] = { 0x0020, 0xFFFF, 0 };
+    for (int file_n = 0; file_n < IM_ARRAYSIZE(BENCH_FONTBUILD_FONT_FILES); file_n++)
+        for (int size_n = 0; size_n < IM_ARRAYSIZE(BENCH_FONTBUILD_FONT_SIZES); size_n++)
+        {
+            ImFontConfig cfg;
+            cfg.RasterizerMultiply = (file_n == 0) ? 1.2f : 1.0f;
+            if (atlas->AddFontFromFileTTF(BENCH_FONTBUILD_FONT_FILES[file_n], BENCH_FONTBUILD_FONT_SIZES[size_n], &cfg, ranges) == NULL)
+            {
+                fprintf(stderr, "Failed to load '%s', run from misc/benchmark/\n", BENCH_FONTBUILD_FONT_FILES[file_n]);
+                exit(1);
+            }
+        }
+}
+
+static void BenchBuildBundledFontsAtlas(ImFontAtlas* atlas)
+{
+    BenchAddBundledFonts(atlas);
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    atlas->GetTexDataAsAlpha8(&tex_pixels, &tex_w, &tex_h);
+}
+
+// Texture, custom rectangles, fonts metrics, glyphs (hashed field by field, ImFontGlyph has padding after Codepoint) and lookup tables
+static ImU32 BenchHashAtlas(const ImFontAtlas* atlas)
+{
+    ImU32 hash = ImHashData(atlas->TexPixelsAlpha8, (size_t)(atlas->TexWidth * atlas->TexHeight));
+    hash = ImHashData(&atlas->TexUvWhitePixel, sizeof(ImVec2), hash);
+    for (int rect_n = 0; rect_n < atlas->CustomRects.Size; rect_n++)
+    {
+        hash = ImHashData(&atlas->CustomRects[rect_n].X, sizeof(unsigned short), hash);
+        hash = ImHashData(&atlas->CustomRects[rect_n].Y, sizeof(unsigned short), hash);
+    }
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        const ImFont* font = atlas->Fonts[font_n];
+        const float metrics[] = { font->FontSize, font->Ascent, font->Descent, font->FallbackAdvanceX, (float)font->MetricsTotalSurface, (float)font->ConfigDataCount, font->FallbackGlyph ? (float)font->FallbackGlyph->Codepoint : -1.0f };
+        hash = ImHashData(metrics, sizeof(metrics), hash);
+        for (int glyph_n = 0; glyph_n < font->Glyphs.Size; glyph_n++)
+        {
+            const ImFontGlyph& glyph = font->Glyphs[glyph_n];
+            hash = ImHashData(&glyph.Codepoint, sizeof(glyph.Codepoint), hash);
+            hash = ImHashData(&glyph.AdvanceX, sizeof(float) * 9, hash);
+        }
+        hash = ImHashData(font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes(), hash);
+        hash = ImHashData(font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes(), hash);
+    }
+    return hash;
+}
+
+static void Bench_FontBuild()
+{
+    // Glyphs are packed serially then rasterized by jobs of a few glyphs, on 1 to 16 threads. Output must be identical to the serial build.
+    static const int threads_counts[] = { 0, 1, 2, 4, 8, 16 };
+    static const char* case_names[] = { "serial", "threads=1", "threads=2", "threads=4", "threads=8", "threads=16" };
+    BenchReport("fontbuild", "", "hardware_threads", (double)std::thread::hardware_concurrency());
+    ImU32 serial_hash = 0;
+    double serial_ms = 0.0;
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(threads_counts); case_n++)
+    {
+        BenchThreadPool thread_pool(ImMax(1, threads_counts[case_n]));
+        double best_ms = 0.0;
+        ImU32 hash = 0;
+        for (int rep_n = 0; rep_n < 3; rep_n++)
+        {
+            ImFontAtlas atlas;
+            atlas.ParallelForFn = (threads_counts[case_n] > 0) ? BenchThreadPool::ParallelFor : NULL;
+            atlas.ParallelForUserData = &thread_pool;
+            double t0 = GetTimeNs();
+            BenchBuildBundledFontsAtlas(&atlas);
+            double t1 = GetTimeNs();
+            best_ms = (rep_n == 0) ? (t1 - t0) / 1000000.0 : ImMin(best_ms, (t1 - t0) / 1000000.0);
+            hash = BenchHashAtlas(&atlas);
+            if (case_n == 0 && rep_n == 0)
+            {
+                int glyphs_count = 0;
+                for (int font_n = 0; font_n < atlas.Fonts.Size; font_n++)
+                    glyphs_count += atlas.Fonts[font_n]->Glyphs.Size;
+                BenchReport("fontbuild", "", "glyphs", (double)glyphs_count);
+                BenchReport("fontbuild", "", "tex_kb", atlas.TexWidth * atlas.TexHeight / 1024.0);
+            }
+        }
+        if (case_n == 0)
+        {
+            serial_hash = hash;
+            serial_ms = best_ms;
+        }
+        BenchReport("fontbuild", case_names[case_n], "build_ms", best_ms);
+        BenchReport("fontbuild", case_names[case_n], "speedup", serial_ms / best_ms);
+        BenchReport("fontbuild", case_names[case_n], "output_identical", hash == serial_hash ? 1.0 : 0.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: on-disk atlas cache (ImFontAtlas::CacheFilename)
+//-----------------------------------------------------------------------------
+
+static const char* BENCH_ATLASCACHE_FILENAME = "imgui_benchmark_atlas.cache";
+
+static void Bench_AtlasCache()
+{
+    // Startup of the 'fontbuild' atlas: TTF files loading + Build(), without cache, with a cold cache (build + save) and a warm cache (load).
+    // The atlas loaded from the cache must be identical to a regular build, stale or corrupted cache files must be rejected.
+    remove(BENCH_ATLASCACHE_FILENAME);
+    static const char* case_names[] = { "nocache", "cold", "warm" };
+    ImU32 hashes[IM_ARRAYSIZE(case_names)];
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(case_names); case_n++)
+    {
+        ImFontAtlas atlas;
+        atlas.CacheFilename = (case_n > 0) ? BENCH_ATLASCACHE_FILENAME : NULL;
+        double t0 = GetTimeNs();
+        BenchAddBundledFonts(&atlas);
+        double t1 = GetTimeNs();
+        atlas.Build();
+        double t2 = GetTimeNs();
+        hashes[case_n] = BenchHashAtlas(&atlas);
+        BenchReport("atlascache", case_names[case_n], "startup_ms", (t2 - t0) / 1000000.0);
+        BenchReport("atlascache", case_names[case_n], "build_ms", (t2 - t1) / 1000000.0);
+        BenchReport("atlascache", case_names[case_n], "output_identical", hashes[case_n] == hashes[0] ? 1.0 : 0.0);
+    }
+    size_t file_size = 0;
+    if (void* file_data = ImFileLoadToMemory(BENCH_ATLASCACHE_FILENAME, "rb", &file_size))
+    {
+        BenchReport("atlascache", "", "file_kb", file_size / 1024.0);
+
+        // Flip a pixel
+        ((unsigned char*)file_data)[file_size - 1] ^= 0x01;
+        FILE* f = ImFileOpen(BENCH_ATLASCACHE_FILENAME, "wb");
+        fwrite(file_data, file_size, 1, f);
+        fclose(f);
+        IM_FREE(file_data);
+        ImFontAtlas atlas;
+        BenchAddBundledFonts(&atlas);
+        BenchReport("atlascache", "corrupt", "rejected", ImFontAtlasBuildLoadCache(&atlas, BENCH_ATLASCACHE_FILENAME) ? 0.0 : 1.0);
+    }
+
+    // Same fonts with a different padding: the cache is rebuilt and overwritten
+    {
+        ImFontAtlas atlas;
+        BenchAddBundledFonts(&atlas);
+        atlas.TexGlyphPadding = 2;
+        BenchReport("atlascache", "stale", "rejected", ImFontAtlasBuildLoadCache(&atlas, BENCH_ATLASCACHE_FILENAME) ? 0.0 : 1.0);
+        atlas.CacheFilename = BENCH_ATLASCACHE_FILENAME;
+        atlas.Build();
+        ImFontAtlas atlas_reloaded;
+        BenchAddBundledFonts(&atlas_reloaded);
+        atlas_reloaded.TexGlyphPadding = 2;
+        BenchReport("atlascache", "stale", "rebuilt_cache_hit", ImFontAtlasBuildLoadCache(&atlas_reloaded, BENCH_ATLASCACHE_FILENAME) && BenchHashAtlas(&atlas_reloaded) == BenchHashAtlas(&atlas) ? 1.0 : 0.0);
+    }
+    remove(BENCH_ATLASCACHE_FILENAME);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: paged glyph index (ImFont::IndexPages, ImFont::GetIndexOffset())
+//-----------------------------------------------------------------------------
+
+static const int BENCH_GLYPHINDEX_TEXT_GLYPHS = 4096;
+static const int BENCH_GLYPHINDEX_REPEAT = 100;
+
+// Previous layout: lookup tables indexed directly by code-point, up to the highest one
+struct BenchDenseGlyphIndex
+{
+    const ImFont*       Font;
+    ImVector<float>     IndexAdvanceX;
+    ImVector<ImWchar>   IndexLookup;
+
+    void Build(const ImFont* font)
+    {
+        Font = font;
+        int max_codepoint = 0;
+        for (int glyph_n = 0; glyph_n < font->Glyphs.Size; glyph_n++)
+            max_codepoint = ImMax(max_codepoint, (int)font->Glyphs[glyph_n].Codepoint);
+        IndexAdvanceX.resize(max_codepoint + 1, font->FallbackAdvanceX);
+        IndexLookup.resize(max_codepoint + 1, (ImWchar)-1);
+        for (int glyph_n = 0; glyph_n < font->Glyphs.Size; glyph_n++)
+        {
+            IndexAdvanceX[font->Glyphs[glyph_n].Codepoint] = font->Glyphs[glyph_n].AdvanceX;
+            IndexLookup[font->Glyphs[glyph_n].Codepoint] = (ImWchar)glyph_n;
+        }
+    }
+    const ImFontGlyph* FindGlyph(unsigned int c) const
+    {
+        if (c >= (unsigned int)IndexLookup.Size)
+            return Font->FallbackGlyph;
+        const ImWchar i = IndexLookup.Data[c];
+        return (i == (ImWchar)-1) ? Font->FallbackGlyph : &Font->Glyphs.Data[i];
+    }
+    float GetCharAdvance(unsigned int c) const { return (c < (unsigned int)IndexAdvanceX.Size) ? IndexAdvanceX.Data[c] : Font->FallbackAdvanceX; }
+
+    // Same as ImFont::CalcTextSizeA() without word-wrapping
+    ImVec2 CalcTextSize(float size, float max_width, const char* text_begin, const char* text_end) const
+    {
+        const float line_height = size;
+        const float scale = size / Font->FontSize;
+        ImVec2 text_size = ImVec2(0, 0);
+        float line_width = 0.0f;
+        const char* s = text_begin;
+        while (s < text_end)
+        {
+            const char* prev_s = s;
+            unsigned int c = (unsigned int)*s;
+            if (c < 0x80)
+            {
+                s += 1;
+            }
+            else
+            {
+                s += ImTextCharFromUtf8(&c, s, text_end);
+                if (c == 0)
+                    break;
+            }
+            if (c < 32)
+            {
+                if (c == '\n')
+                {
+                    text_size.x = ImMax(text_size.x, line_width);
+                    text_size.y += line_height;
+                    line_width = 0.0f;
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
+            }
+            const float char_width = GetCharAdvance(c) * scale;
+            if (line_width + char_width >= max_width)
+            {
+                s = prev_s;
+                break;
+            }
+            line_width += char_width;
+        }
+        if (text_size.x < line_width)
+            text_size.x = line_width;
+        if (line_width > 0 || text_size.y == 0.0f)
+            text_size.y += line_height;
+        return text_size;
+    }
+};
+
+static void Bench_GlyphIndex()
+{
+    // Lookup tables memory of every bundled font (0x20..0xFFFF) at 2 sizes, paged vs indexed directly by code-point
+    ImFontAtlas atlas;
+    BenchBuildBundledFontsAtlas(&atlas);
+    double dense_bytes = 0.0, paged_bytes = 0.0;
+    for (int font_n = 0; font_n < atlas.Fonts.Size; font_n++)
+    {
+        const ImFont* font = atlas.Fonts[font_n];
+        BenchDenseGlyphIndex dense;
+        dense.Build(font);
+        dense_bytes += dense.IndexAdvanceX.size_in_bytes() + dense.IndexLookup.size_in_bytes();
+        paged_bytes += font->IndexAdvanceX.size_in_bytes() + font->IndexLookup.size_in_bytes() + font->IndexPages.size_in_bytes();
+    }
+    BenchReport("glyphindex", "dense", "index_kb", dense_bytes / 1024.0);
+    BenchReport("glyphindex", "paged", "index_kb", paged_bytes / 1024.0);
+
+    // Throughput of lookups, advances and CalcTextSizeA() with DroidSans: English, Latin-1 and Greek/Cyrillic text
+    ImGuiContext* ctx = ImGui::CreateContext(&atlas);
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+    ImFont* font = atlas.Fonts[1];
+    BenchDenseGlyphIndex dense;
+    dense.Build(font);
+    static const char* text_names[] = { "ascii", "latin1", "greek_cyrillic" };
+    static const char* ascii_words = "The quick brown fox jumps over the lazy dog, 0123456789 times! ";
+    static const ImWchar latin1_chars[] = { 0xE9, 0xE8, 0xE0, 0xE7, 0xF4, 0xFC, 0xF6, 0xE4, 0xDF, 0xF1 };
+    for (int text_n = 0; text_n < IM_ARRAYSIZE(text_names); text_n++)
+    {
+        ImVector<ImWchar> text_w;
+        for (int n = 0; n < BENCH_GLYPHINDEX_TEXT_GLYPHS; n++)
+        {
+            ImWchar c = (ImWchar)ascii_words[n % strlen(ascii_words)];
+            if (text_n == 1 && (n % 5) == 2)
+                c = latin1_chars[(n / 5) % IM_ARRAYSIZE(latin1_chars)];
+            if (text_n == 2 && c != ' ')
+                c = (ImWchar)(((n / 7) & 1) ? 0x391 + (n % 57) : 0x410 + (n % 64));
+            text_w.push_back(c);
+        }
+        ImVector<char> text;
+        text.resize(BENCH_GLYPHINDEX_TEXT_GLYPHS * 3 + 1);
+        const int text_len = ImTextStrToUtf8(text.Data, text.Size, text_w.Data, text_w.Data + text_w.Size);
+        const char* text_end = text.Data + text_len;
+
+        // Both layouts must give the same glyphs and advances
+        bool output_identical = true;
+        for (int n = 0; n < text_w.Size; n++)
+            output_identical &= (font->FindGlyph(text_w[n]) == dense.FindGlyph(text_w[n])) && (font->GetCharAdvance(text_w[n]) == dense.GetCharAdvance(text_w[n]));
+        const ImVec2 size_paged = font->CalcTextSizeA(font->FontSize, FLT_MAX, 0.0f, text.Data, text_end);
+        const ImVec2 size_dense = dense.CalcTextSize(font->FontSize, FLT_MAX, text.Data, text_end);
+        output_identical &= (size_paged.x == size_dense.x && size_paged.y == size_dense.y);
+
+        // Best of 5 runs. FindGlyph() and RenderText() are only measured with the paged layout (ImFont::FindGlyph() isn't inline and handles ImFontAtlasFlags_DynamicGlyphs)
+        const double glyphs_count = (double)BENCH_GLYPHINDEX_TEXT_GLYPHS * BENCH_GLYPHINDEX_REPEAT;
+        double advance_ns[2] = { DBL_MAX, DBL_MAX }, calcsize_ns[2] = { DBL_MAX, DBL_MAX }, findglyph_ns = DBL_MAX, render_ns = DBL_MAX;
+        ImDrawList draw_list(ImGui::GetDrawListSharedData());
+        for (int run_n = 0; run_n < 5; run_n++)
+        {
+            float sink_f = 0.0f;
+            for (int layout_n = 0; layout_n < 2; layout_n++)
+            {
+                double t0 = GetTimeNs();
+                for (int rep_n = 0; rep_n < BENCH_GLYPHINDEX_REPEAT; rep_n++)
+                    for (int n = 0; n < text_w.Size; n++)
+                        sink_f += (layout_n == 0) ? dense.GetCharAdvance(text_w[n]) : font->GetCharAdvance(text_w[n]);
+                double t1 = GetTimeNs();
+                for (int rep_n = 0; rep_n < BENCH_GLYPHINDEX_REPEAT; rep_n++)
+                    sink_f += (layout_n == 0) ? dense.CalcTextSize(font->FontSize, FLT_MAX, text.Data, text_end).x : font->CalcTextSizeA(font->FontSize, FLT_MAX, 0.0f, text.Data, text_end).x;
+                double t2 = GetTimeNs();
+                advance_ns[layout_n] = ImMin(advance_ns[layout_n], t1 - t0);
+                calcsize_ns[layout_n] = ImMin(calcsize_ns[layout_n], t2 - t1);
+            }
+            ImU32 sink = 0;
+            double t0 = GetTimeNs();
+            for (int rep_n = 0; rep_n < BENCH_GLYPHINDEX_REPEAT; rep_n++)
+                for (int n = 0; n < text_w.Size; n++)
+                    sink += font->FindGlyph(text_w[n])->Codepoint;
+            findglyph_ns = ImMin(findglyph_ns, GetTimeNs() - t0);
+            GBenchSink += sink + (ImU32)sink_f;
+
+            double run_render_ns = 0.0;
+            for (int rep_n = 0; rep_n < BENCH_GLYPHINDEX_REPEAT; rep_n++)
+            {
+                draw_list.Clear();
+                draw_list.PushClipRectFullScreen();
+                draw_list.PushTextureID(atlas.TexID);
+                double t1 = GetTimeNs();
+                draw_list.AddText(font, font->FontSize, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, text.Data, text_end);
+                run_render_ns += GetTimeNs() - t1;
+            }
+            render_ns = ImMin(render_ns, run_render_ns);
+        }
+        char case_name[64];
+        for (int layout_n = 0; layout_n < 2; layout_n++)
+        {
+            ImFormatString(case_name, IM_ARRAYSIZE(case_name), "%s_%s", layout_n == 0 ? "dense" : "paged", text_names[text_n]);
+            BenchReport("glyphindex", case_name, "advance_ns_per_glyph", advance_ns[layout_n] / glyphs_count);
+            BenchReport("glyphindex", case_name, "calcsize_ns_per_glyph", calcsize_ns[layout_n] / glyphs_count);
+        }
+        BenchReport("glyphindex", case_name, "findglyph_ns_per_glyph", findglyph_ns / glyphs_count);
+        BenchReport("glyphindex", case_name, "rendertext_ns_per_glyph", render_ns / glyphs_count);
+        BenchReport("glyphindex", case_name, "output_identical", output_identical ? 1.0 : 0.0);
+    }
+    ImGui::EndFrame();
+    ImGui::DestroyContext(ctx);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: ASCII fast path of text functions (ImFont::CalcTextSizeA(), ImFont::RenderText())
+//-----------------------------------------------------------------------------
+
+static const int BENCH_TEXT_LINES = 128;
+static const int BENCH_TEXT_LINE_GLYPHS = 96;
+static const int BENCH_TEXT_REPEAT = 20;
+
+// Previous implementation, decoding and rendering one character at a time (without 'cpu_fine_clip', which disables the fast path)
+struct BenchScalarText
+{
+    static ImVec2 CalcTextSize(const ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining)
+    {
+        const float line_height = size;
+        const float scale = size / font->FontSize;
+        ImVec2 text_size = ImVec2(0, 0);
+        float line_width = 0.0f;
+        const bool word_wrap_enabled = (wrap_width > 0.0f);
+        const char* word_wrap_eol = NULL;
+        const char* s = text_begin;
+        while (s < text_end)
+        {
+            if (word_wrap_enabled)
+            {
+                if (!word_wrap_eol)
+                {
+                    word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+                    if (word_wrap_eol == s)
+                        word_wrap_eol++;
+                }
+                if (s >= word_wrap_eol)
+                {
+                    if (text_size.x < line_width)
+                        text_size.x = line_width;
+                    text_size.y += line_height;
+                    line_width = 0.0f;
+                    word_wrap_eol = NULL;
+                    while (s < text_end)
+                    {
+                        const char c = *s;
+                        if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+                    }
+                    continue;
+                }
+            }
+            const char* prev_s = s;
+            unsigned int c = (unsigned int)*s;
+            if (c < 0x80)
+            {
+                s += 1;
+            }
+            else
+            {
+                s += ImTextCharFromUtf8(&c, s, text_end);
+                if (c == 0)
+                    break;
+            }
+            if (c < 32)
+            {
+                if (c == '\n')
+                {
+                    text_size.x = ImMax(text_size.x, line_width);
+                    text_size.y += line_height;
+                    line_width = 0.0f;
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
+            }
+            const int char_offset = font->GetIndexOffset(c);
+            const float char_width = (char_offset >= 0 ? font->IndexAdvanceX.Data[char_offset] : font->FallbackAdvanceX) * scale;
+            if (line_width + char_width >= max_width)
+            {
+                s = prev_s;
+                break;
+            }
+            line_width += char_width;
+        }
+        if (text_size.x < line_width)
+            text_size.x = line_width;
+        if (line_width > 0 || text_size.y == 0.0f)
+            text_size.y += line_height;
+        if (remaining)
+            *remaining = s;
+        return text_size;
+    }
+
+    static void RenderText(const ImFont* font, ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width)
+    {
+        pos.x = (float)(int)pos.x + font->DisplayOffset.x;
+        pos.y = (float)(int)pos.y + font->DisplayOffset.y;
+        float x = pos.x;
+        float y = pos.y;
+        if (y > clip_rect.w)
+            return;
+        const float scale = size / font->FontSize;
+        const float line_height = font->FontSize * scale;
+        const bool word_wrap_enabled = (wrap_width > 0.0f);
+        const char* word_wrap_eol = NULL;
+        const char* s = text_begin;
+        if (s == text_end)
+            return;
+        const int vtx_count_max = (int)(text_end - s) * 4;
+        const int idx_count_max = (int)(text_end - s) * 6;
+        const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
+        ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+        ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+        unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+        while (s < text_end)
+        {
+            if (word_wrap_enabled)
+            {
+                if (!word_wrap_eol)
+                {
+                    word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - pos.x));
+                    if (word_wrap_eol == s)
+                        word_wrap_eol++;
+                }
+                if (s >= word_wrap_eol)
+                {
+                    x = pos.x;
+                    y += line_height;
+                    word_wrap_eol = NULL;
+                    while (s < text_end)
+                    {
+                        const char c = *s;
+                        if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+                    }
+                    continue;
+                }
+            }
+            unsigned int c = (unsigned int)*s;
+            if (c < 0x80)
+            {
+                s += 1;
+            }
+            else
+            {
+                s += ImTextCharFromUtf8(&c, s, text_end);
+                if (c == 0)
+                    break;
+            }
+            if (c < 32)
+            {
+                if (c == '\n')
+                {
+                    x = pos.x;
+                    y += line_height;
+                    if (y > clip_rect.w)
+                        break;
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
+            }
+            float char_width = 0.0f;
+            if (const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c))
+            {
+                char_width = glyph->AdvanceX * scale;
+                if (c != ' ' && c != '\t')
+                {
+                    float x1 = x + glyph->X0 * scale;
+                    float x2 = x + glyph->X1 * scale;
+                    float y1 = y + glyph->Y0 * scale;
+                    float y2 = y + glyph->Y1 * scale;
+                    if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+                    {
+                        idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
+                        idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
+                        vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = col; vtx_write[0].uv = ImVec2(glyph->U0, glyph->V0);
+                        vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = col; vtx_write[1].uv = ImVec2(glyph->U1, glyph->V0);
+                        vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = col; vtx_write[2].uv = ImVec2(glyph->U1, glyph->V1);
+                        vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = col; vtx_write[3].uv = ImVec2(glyph->U0, glyph->V1);
+                        vtx_write += 4;
+                        vtx_current_idx += 4;
+                        idx_write += 6;
+                    }
+                }
+            }
+            x += char_width;
+        }
+        draw_list->VtxBuffer.resize((int)(vtx_write - draw_list->VtxBuffer.Data));
+        draw_list->IdxBuffer.resize((int)(idx_write - draw_list->IdxBuffer.Data));
+        draw_list->CmdBuffer[draw_list->CmdBuffer.Size-1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+        draw_list->_VtxWritePtr = vtx_write;
+        draw_list->_IdxWritePtr = idx_write;
+        draw_list->_VtxCurrentIdx = vtx_current_idx;
+    }
+};
+
+static void BenchResetDrawList(ImDrawList* draw_list, ImTextureID tex_id)
+{
+    draw_list->Clear();
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(tex_id);
+}
+
+static bool BenchCompareDrawListGeometry(const ImDrawList* a, const ImDrawList* b)
+{
+    if (a->VtxBuffer.Size != b->VtxBuffer.Size || a->IdxBuffer.Size != b->IdxBuffer.Size || a->CmdBuffer.back().ElemCount != b->CmdBuffer.back().ElemCount)
+        return false;
+    return memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.size_in_bytes()) == 0 && memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.size_in_bytes()) == 0;
+}
+
+static void Bench_Text()
+{
+    ImFontAtlas atlas;
+    BenchBuildBundledFontsAtlas(&atlas);
+    ImGuiContext* ctx = ImGui::CreateContext(&atlas);
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+
+    // Lines of English, Latin-1 (1 character out of 5) and Greek/Cyrillic text with DroidSans
+    ImFont* font = atlas.Fonts[1];
+    static const char* text_names[] = { "ascii", "latin1", "greek_cyrillic" };
+    static const char* ascii_words = "The quick brown fox jumps over the lazy dog, 0123456789 times! ";
+    static const ImWchar latin1_chars[] = { 0xE9, 0xE8, 0xE0, 0xE7, 0xF4, 0xFC, 0xF6, 0xE4, 0xDF, 0xF1 };
+    for (int text_n = 0; text_n < IM_ARRAYSIZE(text_names); text_n++)
+    {
+        ImVector<ImWchar> text_w;
+        for (int line_n = 0; line_n < BENCH_TEXT_LINES; line_n++)
+        {
+            for (int glyph_n = 0; glyph_n < BENCH_TEXT_LINE_GLYPHS; glyph_n++)
+            {
+                const int n = line_n * 7 + glyph_n;
+                ImWchar c = (ImWchar)ascii_words[n % strlen(ascii_words)];
+                if (text_n == 1 && (n % 5) == 2)
+                    c = latin1_chars[(n / 5) % IM_ARRAYSIZE(latin1_chars)];
+                if (text_n == 2 && c != ' ')
+                    c = (ImWchar)(((n / 7) & 1) ? 0x391 + (n % 57) : 0x410 + (n % 64));
+                text_w.push_back(c);
+            }
+            text_w.push_back('\n');
+        }
+        ImVector<char> text;
+        text.resize(text_w.Size * 3 + 1);
+        const char* text_end = text.Data + ImTextStrToUtf8(text.Data, text.Size, text_w.Data, text_w.Data + text_w.Size);
+
+        // Sizes, remaining text and geometry must be identical: without and with wrapping, with lines cut by 'max_width' or by the clipping rectangle
+        bool output_identical = true;
+        const float sizes_args[][2] = { { FLT_MAX, 0.0f }, { FLT_MAX, 300.0f }, { 400.0f, 0.0f } }; // max_width, wrap_width
+        for (int args_n = 0; args_n < IM_ARRAYSIZE(sizes_args); args_n++)
+        {
+            const char* remaining_scalar = NULL;
+            const char* remaining_fast = NULL;
+            const ImVec2 size_scalar = BenchScalarText::CalcTextSize(font, font->FontSize, sizes_args[args_n][0], sizes_args[args_n][1], text.Data, text_end, &remaining_scalar);
+            const ImVec2 size_fast = font->CalcTextSizeA(font->FontSize, sizes_args[args_n][0], sizes_args[args_n][1], text.Data, text_end, &remaining_fast);
+            output_identical &= (size_scalar.x == size_fast.x && size_scalar.y == size_fast.y && remaining_scalar == remaining_fast);
+        }
+        ImDrawList draw_list_scalar(ImGui::GetDrawListSharedData());
+        ImDrawList draw_list_fast(ImGui::GetDrawListSharedData());
+        const ImVec4 clip_rect_full(0.0f, 0.0f, 1920.0f, 4096.0f);
+        const ImVec4 clip_rect_cut(100.0f, 0.0f, 300.0f, 4096.0f);
+        for (int args_n = 0; args_n < 3; args_n++)
+        {
+            const ImVec4& clip_rect = (args_n == 2) ? clip_rect_cut : clip_rect_full;
+            const float wrap_width = (args_n == 1) ? 300.0f : 0.0f;
+            BenchResetDrawList(&draw_list_scalar, atlas.TexID);
+            BenchResetDrawList(&draw_list_fast, atlas.TexID);
+            BenchScalarText::RenderText(font, &draw_list_scalar, font->FontSize, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, clip_rect, text.Data, text_end, wrap_width);
+            font->RenderText(&draw_list_fast, font->FontSize, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, clip_rect, text.Data, text_end, wrap_width, false);
+            output_identical &= BenchCompareDrawListGeometry(&draw_list_scalar, &draw_list_fast);
+        }
+
+        // Best of 5 runs
+        double calcsize_ns[2] = { DBL_MAX, DBL_MAX }, render_ns[2] = { DBL_MAX, DBL_MAX };
+        for (int run_n = 0; run_n < 5; run_n++)
+        {
+            for (int impl_n = 0; impl_n < 2; impl_n++)
+            {
+                float sink_f = 0.0f;
+                double t0 = GetTimeNs();
+                for (int rep_n = 0; rep_n < BENCH_TEXT_REPEAT; rep_n++)
+                    sink_f += (impl_n == 0) ? BenchScalarText::CalcTextSize(font, font->FontSize, FLT_MAX, 0.0f, text.Data, text_end, NULL).x : font->CalcTextSizeA(font->FontSize, FLT_MAX, 0.0f, text.Data, text_end).x;
+                calcsize_ns[impl_n] = ImMin(calcsize_ns[impl_n], GetTimeNs() - t0);
+                GBenchSink += (ImU32)sink_f;
+
+                ImDrawList* draw_list = (impl_n == 0) ? &draw_list_scalar : &draw_list_fast;
+                double run_render_ns = 0.0;
+                for (int rep_n = 0; rep_n < BENCH_TEXT_REPEAT; rep_n++)
+                {
+                    BenchResetDrawList(draw_list, atlas.TexID);
+                    double t1 = GetTimeNs();
+                    if (impl_n == 0)
+                        BenchScalarText::RenderText(font, draw_list, font->FontSize, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, clip_rect_full, text.Data, text_end, 0.0f);
+                    else
+                        font->RenderText(draw_list, font->FontSize, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, clip_rect_full, text.Data, text_end, 0.0f, false);
+                    run_render_ns += GetTimeNs() - t1;
+                }
+                render_ns[impl_n] = ImMin(render_ns[impl_n], run_render_ns);
+            }
+        }
+        const double glyphs_count = (double)BENCH_TEXT_LINES * BENCH_TEXT_LINE_GLYPHS * BENCH_TEXT_REPEAT;
+        char case_name[64];
+        for (int impl_n = 0; impl_n < 2; impl_n++)
+        {
+            ImFormatString(case_name, IM_ARRAYSIZE(case_name), "%s_%s", impl_n == 0 ? "scalar" : "fast", text_names[text_n]);
+            BenchReport("text", case_name, "calcsize_mglyphs_per_s", glyphs_count * 1000.0 / calcsize_ns[impl_n]);
+            BenchReport("text", case_name, "rendertext_mglyphs_per_s", glyphs_count * 1000.0 / render_ns[impl_n]);
+        }
+        BenchReport("text", case_name, "output_identical", output_identical ? 1.0 : 0.0);
+    }
+    ImGui::EndFrame();
+    ImGui::DestroyContext(ctx);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark: input record/replay
+//-----------------------------------------------------------------------------
+
+static void Bench_Replay()
+{
+    // Record scripted inputs, replay them into a new context and verify the draw data is identical.
+    // (the demo window has static state which we can't reset, so we only use the stress windows here)
+    const BenchFramesCase& bench_case = GBenchFramesCases[1];
+    ImGuiInputRecorder recorder;
+    BenchFramesResults results_recorded, results_replayed;
+    BenchRunFrames(bench_case, GBenchFramesCount, &recorder, NULL, true, &results_recorded);
+    ImGuiInputReplayer replayer;
+    if (!replayer.LoadFromMemory(recorder.Data.Data, (size_t)recorder.Data.Size))
+    {
+        fprintf(stderr, "Failed to load input record!\n");
+        exit(1);
+    }
+    BenchRunFrames(bench_case, 0, NULL, &replayer, true, &results_replayed);
+    if (results_replayed.FramesCount != results_recorded.FramesCount || results_replayed.DrawDataHash != results_recorded.DrawDataHash)
+    {
+        fprintf(stderr, "Replayed frames don't match recorded frames!\n");
+        exit(1);
+    }
+    if (GBenchRecordFilename && !recorder.SaveToFile(GBenchRecordFilename))
+        fprintf(stderr, "Failed to save input record to '%s'\n", GBenchRecordFilename);
+    BenchReport("replay", bench_case.Name, "record_bytes_per_frame", (double)recorder.Data.Size / recorder.FramesCount);
+    BenchReportFrames("replay", bench_case.Name, results_replayed);
+
+    // Replay a recorded session (e.g. captured with 'kisymgen --record'). Frames are submitted with ShowDemoWindow() + stress windows.
+    if (GBenchReplayFilename)
+    {
+        if (!replayer.LoadFromFile(GBenchReplayFilename))
+        {
+            fprintf(stderr, "Failed to load input record from '%s'\n", GBenchReplayFilename);
+            exit(1);
+        }
+        BenchRunFrames(GBenchFramesCases[2], 0, NULL, &replayer, false, &results_replayed);
+        BenchReportFrames("replay", "file", results_replayed);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+typedef void (*BenchFunc)();
+struct BenchEntry
+{
+    const char* Name;
+    BenchFunc   Func;
+};
+
+static const BenchEntry GBenchEntries[] =
+{
+    { "hash",           Bench_Hash },
+    { "storage",        Bench_Storage },
+    { "ini",            Bench_IniLoad },
+    { "frames",         Bench_Frames },
+    { "retained",       Bench_Retained },
+    { "tessellation",   Bench_Tessellation },
+    { "drawlists",      Bench_DrawLists },
+    { "flatten",        Bench_Flatten },
+    { "occlusion",      Bench_Occlusion },
+    { "vtxformat",      Bench_VtxFormat },
+    { "windows_gc",     Bench_WindowsGC },
+    { "allocaudit",     Bench_AllocAudit },
+    { "arena",          Bench_FrameArena },
+    { "memtags",        Bench_MemoryTags },
+    { "dynatlas",       Bench_DynamicAtlas },
+    { "fontbuild",      Bench_FontBuild },
+    { "atlascache",     Bench_AtlasCache },
+    { "glyphindex",     Bench_GlyphIndex },
+    { "text",           Bench_Text },
+    { "replay",         Bench_Replay },
+};
+
+// Usage: imgui_benchmark [filter] [--frames=N] [--record=filename] [--replay=filename]
+int main(int argc, char** argv)
+{
+    const char* filter = NULL;
+    for (int arg_n = 1; arg_n < argc; arg_n++)
+    {
+        if (strncmp(argv[arg_n], "--frames=", 9) == 0)
+            GBenchFramesCount = ImMax(1, atoi(argv[arg_n] + 9));
+        else if (strncmp(argv[arg_n], "--record=", 9) == 0)
+            GBenchRecordFilename = argv[arg_n] + 9;
+        else if (strncmp(argv[arg_n], "--replay=", 9) == 0)
+            GBenchReplayFilename = argv[arg_n] + 9;
+        else
+            filter = argv[arg_n];
+    }
+    ImGui::SetAllocatorFunctions(BenchMallocWrapper, BenchFreeWrapper);
+
+    for (int n = 0; n < IM_ARRAYSIZE(GBenchEntries); n++)
+        if (filter == NULL || strstr(GBenchEntries[n].Name, filter) != NULL)
+            GBenchEntries[n].Func();
+    return 0;
+}
@@ -0,0 +1,366 @@
+// imgui_input_record.cpp
+// Record the ImGuiIO inputs of every frame into a compact buffer/file, and replay them into a context.
+// See imgui_input_record.h for usage and file format.
+
+// Changelog:
+// - v0.10: Initial version.
+
+#include "imgui.h"
+#include "imgui_input_record.h"
+#include "imgui_internal.h"     // ImFileOpen, ImFileLoadToMemory
+#include <string.h>
+
+static const char   INPUT_RECORD_MAGIC[4] = { 'I', 'M', 'I', 'R' };
+static const ImU32  INPUT_RECORD_VERSION = 1;
+static const int    INPUT_RECORD_FRAMES_COUNT_OFFSET = 8;
+
+// Fields stored for a frame
+enum ImGuiInputRecordField_
+{
+    ImGuiInputRecordField_DeltaTime         = 1 << 0,
+    ImGuiInputRecordField_DisplaySize       = 1 << 1,
+    ImGuiInputRecordField_FramebufferScale  = 1 << 2,
+    ImGuiInputRecordField_MousePos          = 1 << 3,
+    ImGuiInputRecordField_MouseDown         = 1 << 4,
+    ImGuiInputRecordField_KeyMods           = 1 << 5,
+    ImGuiInputRecordField_KeysDown          = 1 << 6,   // varint count + varint indices of keys which toggled
+    ImGuiInputRecordField_MouseWheel        = 1 << 7,   // Not a state: stored when non-zero
+    ImGuiInputRecordField_MouseWheelH       = 1 << 8,   // Not a state: stored when non-zero
+    ImGuiInputRecordField_Chars             = 1 << 9,   // Not a state: varint count + varint characters, stored when non-empty
+    ImGuiInputRecordField_NavInputs         = 1 << 10,
+    ImGuiInputRecordField_All               = (1 << 11) - 1
+};
+
+IM_STATIC_ASSERT(sizeof(ImGuiInputRecordState::KeysDown) == sizeof(ImGuiIO::KeysDown));
+IM_STATIC_ASSERT(sizeof(ImGuiInputRecordState::MouseDown) == sizeof(ImGuiIO::MouseDown));
+
+ImGuiInputRecordState::ImGuiInputRecordState()
+{
+    DeltaTime = 0.0f;
+    DisplaySize = DisplayFramebufferScale = MousePos = ImVec2(0.0f, 0.0f);
+    KeyCtrl = KeyShift = KeyAlt = KeySuper = false;
+    memset(MouseDown, 0, sizeof(MouseDown));
+    memset(KeysDown, 0, sizeof(KeysDown));
+    memset(NavInputs, 0, sizeof(NavInputs));
+}
+
+//-----------------------------------------------------------------------------
+// Encoding helpers
+//-----------------------------------------------------------------------------
+
+static void RecordWrite(ImVector<unsigned char>* buf, const void* data, size_t data_size)
+{
+    const int off = buf->Size;
+    buf->resize(off + (int)data_size);
+    memcpy(buf->Data + off, data, data_size);
+}
+
+static void RecordWriteVarint(ImVector<unsigned char>* buf, ImU32 v)
+{
+    while (v >= 0x80)
+    {
+        buf->push_back((unsigned char)(v | 0x80));
+        v >>= 7;
+    }
+    buf->push_back((unsigned char)v);
+}
+
+struct ImGuiInputRecordReader
+{
+    const unsigned char*    Pos;
+    const unsigned char*    End;
+    bool                    Error;
+
+    ImGuiInputRecordReader(const unsigned char* pos, const unsigned char* end) { Pos = pos; End = end; Error = false; }
+    void Read(void* out_data, size_t data_size)
+    {
+        if (Error || (size_t)(End - Pos) < data_size) { Error = true; memset(out_data, 0, data_size); return; }
+        memcpy(out_data, Pos, data_size);
+        Pos += data_size;
+    }
+    ImU32 ReadVarint()
+    {
+        ImU32 v = 0;
+        for (int shift = 0; shift < 35; shift += 7)
+        {
+            if (Error || Pos >= End) { Error = true; return 0; }
+            const unsigned char c = *Pos++;
+            v |= (ImU32)(c & 0x7F) << shift;
+            if ((c & 0x80) == 0)
+                return v;
+        }
+        Error = true;
+        return 0;
+    }
+};
+
+static unsigned char PackBools(const bool* values, int count)
+{
+    unsigned char bits = 0;
+    for (int n = 0; n < count; n++)
+        if (values[n])
+            bits |= (unsigned char)(1 << n);
+    return bits;
+}
+
+static void UnpackBools(unsigned char bits, bool* values, int count)
+{
+    for (int n = 0; n < count; n++)
+        values[n] = (bits & (1 << n)) != 0;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiInputRecorder
+//-----------------------------------------------------------------------------
+
+void ImGuiInputRecorder::Clear()
+{
+    Data.clear();
+    FramesCount = 0;
+    PrevState = ImGuiInputRecordState();
+}
+
+void ImGuiInputRecorder::RecordFrame(const ImGuiIO& io)
+{
+    if (Data.empty())
+    {
+        const ImU32 header[3] = { INPUT_RECORD_VERSION, 0, (ImU32)ImGuiKey_COUNT };
+        RecordWrite(&Data, INPUT_RECORD_MAGIC, sizeof(INPUT_RECORD_MAGIC));
+        RecordWrite(&Data, header, sizeof(header));
+        RecordWrite(&Data, io.KeyMap, sizeof(io.KeyMap));
+    }
+
+    // Gather current state
+    ImGuiInputRecordState state;
+    state.DeltaTime = io.DeltaTime;
+    state.DisplaySize = io.DisplaySize;
+    state.DisplayFramebufferScale = io.DisplayFramebufferScale;
+    state.MousePos = io.MousePos;
+    memcpy(state.MouseDown, io.MouseDown, sizeof(state.MouseDown));
+    state.KeyCtrl = io.KeyCtrl;
+    state.KeyShift = io.KeyShift;
+    state.KeyAlt = io.KeyAlt;
+    state.KeySuper = io.KeySuper;
+    memcpy(state.KeysDown, io.KeysDown, sizeof(state.KeysDown));
+    memcpy(state.NavInputs, io.NavInputs, sizeof(state.NavInputs));
+    const bool key_mods[4] = { state.KeyCtrl, state.KeyShift, state.KeyAlt, state.KeySuper };
+    const bool prev_key_mods[4] = { PrevState.KeyCtrl, PrevState.KeyShift, PrevState.KeyAlt, PrevState.KeySuper };
+
+    // Compute changes (the first frame stores everything)
+    ImU32 mask = 0;
+    const ImGuiInputRecordState& prev = PrevState;
+    if (FramesCount == 0)
+        mask = ImGuiInputRecordField_All & ~(ImGuiInputRecordField_MouseWheel | ImGuiInputRecordField_MouseWheelH | ImGuiInputRecordField_Chars);
+    if (state.DeltaTime != prev.DeltaTime)                                                                          mask |= ImGuiInputRecordField_DeltaTime;
+    if (state.DisplaySize.x != prev.DisplaySize.x || state.DisplaySize.y != prev.DisplaySize.y)                     mask |= ImGuiInputRecordField_DisplaySize;
+    if (state.DisplayFramebufferScale.x != prev.DisplayFramebufferScale.x || state.DisplayFramebufferScale.y != prev.DisplayFramebufferScale.y) mask |= ImGuiInputRecordField_FramebufferScale;
+    if (state.MousePos.x != prev.MousePos.x || state.MousePos.y != prev.MousePos.y)                                 mask |= ImGuiInputRecordField_MousePos;
+    if (memcmp(state.MouseDown, prev.MouseDown, sizeof(state.MouseDown)) != 0)                                      mask |= ImGuiInputRecordField_MouseDown;
+    if (memcmp(key_mods, prev_key_mods, sizeof(key_mods)) != 0)                                                     mask |= ImGuiInputRecordField_KeyMods;
+    if (memcmp(state.KeysDown, prev.KeysDown, sizeof(state.KeysDown)) != 0)                                         mask |= ImGuiInputRecordField_KeysDown;
+    if (io.MouseWheel != 0.0f)                                                                                      mask |= ImGuiInputRecordField_MouseWheel;
+    if (io.MouseWheelH != 0.0f)                                                                                     mask |= ImGuiInputRecordField_MouseWheelH;
+    if (!io.InputQueueCharacters.empty())                                                                           mask |= ImGuiInputRecordField_Chars;
+    if (memcmp(state.NavInputs, prev.NavInputs, sizeof(state.NavInputs)) != 0)                                      mask |= ImGuiInputRecordField_NavInputs;
+
+    // Encode
+    RecordWriteVarint(&Data, mask);
+    if (mask & ImGuiInputRecordField_DeltaTime)
+        RecordWrite(&Data, &state.DeltaTime, sizeof(float));
+    if (mask & ImGuiInputRecordField_DisplaySize)
+        RecordWrite(&Data, &state.DisplaySize, sizeof(ImVec2));
+    if (mask & ImGuiInputRecordField_FramebufferScale)
+        RecordWrite(&Data, &state.DisplayFramebufferScale, sizeof(ImVec2));
+    if (mask & ImGuiInputRecordField_MousePos)
+        RecordWrite(&Data, &state.MousePos, sizeof(ImVec2));
+    if (mask & ImGuiInputRecordField_MouseDown)
+        Data.push_back(PackBools(state.MouseDown, IM_ARRAYSIZE(state.MouseDown)));
+    if (mask & ImGuiInputRecordField_KeyMods)
+        Data.push_back(PackBools(key_mods, IM_ARRAYSIZE(key_mods)));
+    if (mask & ImGuiInputRecordField_KeysDown)
+    {
+        int toggled_count = 0;
+        for (int n = 0; n < IM_ARRAYSIZE(state.KeysDown); n++)
+            toggled_count += (state.KeysDown[n] != prev.KeysDown[n]) ? 1 : 0;
+        RecordWriteVarint(&Data, (ImU32)toggled_count);
+        for (int n = 0; n < IM_ARRAYSIZE(state.KeysDown); n++)
+            if (state.KeysDown[n] != prev.KeysDown[n])
+                RecordWriteVarint(&Data, (ImU32)n);
+    }
+    if (mask & ImGuiInputRecordField_MouseWheel)
+        RecordWrite(&Data, &io.MouseWheel, sizeof(float));
+    if (mask & ImGuiInputRecordField_MouseWheelH)
+        RecordWrite(&Data, &io.MouseWheelH, sizeof(float));
+    if (mask & ImGuiInputRecordField_Chars)
+    {
+        RecordWriteVarint(&Data, (ImU32)io.InputQueueCharacters.Size);
+        for (int n = 0; n < io.InputQueueCharacters.Size; n++)
+            RecordWriteVarint(&Data, (ImU32)io.InputQueueCharacters[n]);
+    }
+    if (mask & ImGuiInputRecordField_NavInputs)
+        RecordWrite(&Data, state.NavInputs, sizeof(state.NavInputs));
+
+    PrevState = state;
+    FramesCount++;
+    memcpy(Data.Data + INPUT_RECORD_FRAMES_COUNT_OFFSET, &FramesCount, sizeof(ImU32));
+}
+
+bool ImGuiInputRecorder::SaveToFile(const char* filename)
+{
+    FILE* f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = fwrite(Data.Data, 1, (size_t)Data.Size, f) == (size_t)Data.Size;
+    fclose(f);
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiInputReplayer
+//-----------------------------------------------------------------------------
+
+bool ImGuiInputReplayer::LoadFromMemory(const void* data, size_t data_size)
+{
+    Data.clear();
+    FramesCount = 0;
+    Rewind();
+
+    ImGuiInputRecordReader reader((const unsigned char*)data, (const unsigned char*)data + data_size);
+    char magic[4];
+    ImU32 header[3];
+    reader.Read(magic, sizeof(magic));
+    reader.Read(header, sizeof(header));
+    if (reader.Error || memcmp(magic, INPUT_RECORD_MAGIC, sizeof(magic)) != 0 || header[0] != INPUT_RECORD_VERSION)
+        return false;
+    if ((size_t)(reader.End - reader.Pos) / sizeof(int) < header[2])
+        return false;
+
+    Data.resize((int)data_size);
+    memcpy(Data.Data, data, data_size);
+    FramesCount = (int)header[1];
+    return true;
+}
+
+bool ImGuiInputReplayer::LoadFromFile(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (!data)
+        return false;
+    const bool ret = LoadFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
+void ImGuiInputReplayer::Rewind()
+{
+    FrameIdx = 0;
+    DataPos = 0;
+    State = ImGuiInputRecordState();
+}
+
+bool ImGuiInputReplayer::ReplayFrame(ImGuiIO& io)
+{
+    if (FrameIdx >= FramesCount)
+        return false;
+
+    // Decode into locals, io and State are only written once the whole frame decoded successfully
+    ImGuiInputRecordReader reader(Data.Data + DataPos, Data.Data + Data.Size);
+    int key_map[ImGuiKey_COUNT];
+    memcpy(key_map, io.KeyMap, sizeof(key_map));
+    if (FrameIdx == 0)
+    {
+        // Key mapping from header
+        ImU32 key_map_count;
+        reader.Pos += sizeof(INPUT_RECORD_MAGIC) + sizeof(ImU32) * 2;
+        reader.Read(&key_map_count, sizeof(key_map_count));
+        for (ImU32 n = 0; n < key_map_count && !reader.Error; n++)
+        {
+            int key_index;
+            reader.Read(&key_index, sizeof(key_index));
+            if (n < (ImU32)ImGuiKey_COUNT)
+                key_map[n] = key_index;
+        }
+    }
+
+    const ImU32 mask = reader.ReadVarint();
+    ImGuiInputRecordState state = State;
+    ImVector<unsigned int> chars;
+    float mouse_wheel = 0.0f, mouse_wheel_h = 0.0f;
+    if (mask & ImGuiInputRecordField_DeltaTime)
+        reader.Read(&state.DeltaTime, sizeof(float));
+    if (mask & ImGuiInputRecordField_DisplaySize)
+        reader.Read(&state.DisplaySize, sizeof(ImVec2));
+    if (mask & ImGuiInputRecordField_FramebufferScale)
+        reader.Read(&state.DisplayFramebufferScale, sizeof(ImVec2));
+    if (mask & ImGuiInputRecordField_MousePos)
+        reader.Read(&state.MousePos, sizeof(ImVec2));
+    if (mask & ImGuiInputRecordField_MouseDown)
+    {
+        unsigned char bits;
+        reader.Read(&bits, 1);
+        UnpackBools(bits, state.MouseDown, IM_ARRAYSIZE(state.MouseDown));
+    }
+    if (mask & ImGuiInputRecordField_KeyMods)
+    {
+        unsigned char bits;
+        bool key_mods[4];
+        reader.Read(&bits, 1);
+        UnpackBools(bits, key_mods, IM_ARRAYSIZE(key_mods));
+        state.KeyCtrl = key_mods[0];
+        state.KeyShift = key_mods[1];
+        state.KeyAlt = key_mods[2];
+        state.KeySuper = key_mods[3];
+    }
+    if (mask & ImGuiInputRecordField_KeysDown)
+    {
+        const ImU32 toggled_count = reader.ReadVarint();
+        for (ImU32 n = 0; n < toggled_count && !reader.Error; n++)
+        {
+            const ImU32 key_index = reader.ReadVarint();
+            if (key_index < (ImU32)IM_ARRAYSIZE(state.KeysDown))
+                state.KeysDown[key_index] = !state.KeysDown[key_index];
+        }
+    }
+    if (mask & ImGuiInputRecordField_MouseWheel)
+        reader.Read(&mouse_wheel, sizeof(float));
+    if (mask & ImGuiInputRecordField_MouseWheelH)
+        reader.Read(&mouse_wheel_h, sizeof(float));
+    if (mask & ImGuiInputRecordField_Chars)
+    {
+        const ImU32 chars_count = reader.ReadVarint();
+        for (ImU32 n = 0; n < chars_count && !reader.Error; n++)
+            chars.push_back(reader.ReadVarint());
+    }
+    if (mask & ImGuiInputRecordField_NavInputs)
+        reader.Read(state.NavInputs, sizeof(state.NavInputs));
+    if (reader.Error)
+    {
+        FrameIdx = FramesCount;
+        return false;
+    }
+
+    // Apply
+    State = state;
+    memcpy(io.KeyMap, key_map, sizeof(key_map));
+    io.DeltaTime = state.DeltaTime;
+    io.DisplaySize = state.DisplaySize;
+    io.DisplayFramebufferScale = state.DisplayFramebufferScale;
+    io.MousePos = state.MousePos;
+    memcpy(io.MouseDown, state.MouseDown, sizeof(state.MouseDown));
+    io.MouseWheel = mouse_wheel;
+    io.MouseWheelH = mouse_wheel_h;
+    io.KeyCtrl = state.KeyCtrl;
+    io.KeyShift = state.KeyShift;
+    io.KeyAlt = state.KeyAlt;
+    io.KeySuper = state.KeySuper;
+    memcpy(io.KeysDown, state.KeysDown, sizeof(state.KeysDown));
+    memcpy(io.NavInputs, state.NavInputs, sizeof(state.NavInputs));
+    io.InputQueueCharacters.resize(0);
+    for (int n = 0; n < chars.Size; n++)
+        io.AddInputCharacter(chars[n]);
+
+    DataPos = (int)(reader.Pos - Data.Data);
+    FrameIdx++;
+    return true;
+}
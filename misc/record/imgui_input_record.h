@@ -0,0 +1,70 @@
+// imgui_input_record.h
+// Record the ImGuiIO inputs of every frame into a compact buffer/file, and replay them into a context.
+// Used to capture real sessions and replay them (e.g. headlessly in misc/benchmark/) to get reproducible frame-time and draw data numbers.
+
+// Usage:
+// - Record: call Recorder.RecordFrame(io) every frame after your platform back-end NewFrame() and before ImGui::NewFrame().
+//           Call Recorder.SaveToFile() when done.
+// - Replay: call Replayer.ReplayFrame(io) every frame at the same place. It returns false once all frames have been replayed.
+//           The replayed inputs overwrite what the platform back-end wrote in io, so it can be used with or without a back-end.
+// - Replaying gives identical results as long as the application code and the initial state (.ini settings, fonts, style) are identical.
+//   Consider setting io.IniFilename = NULL in both the recording and replaying sessions.
+
+// Recorded inputs:
+// - DeltaTime, DisplaySize, DisplayFramebufferScale, MousePos, MouseDown[], MouseWheel, MouseWheelH,
+//   KeyCtrl/KeyShift/KeyAlt/KeySuper, KeysDown[], NavInputs[], InputQueueCharacters.
+// - KeyMap[] is stored in the header and restored when replaying the first frame.
+
+// File format (native endianness):
+// - Header: char Magic[4] = "IMIR", ImU32 Version, ImU32 FramesCount, ImU32 KeyMapCount, int KeyMap[KeyMapCount]
+// - Frames: varint ChangeMask (see ImGuiInputRecordField_ in imgui_input_record.cpp), followed by the data of each field present in the mask.
+//   Most fields are only stored when they changed since the previous frame. An idle frame takes 1 byte.
+
+// Changelog:
+// - v0.10: Initial version.
+
+#pragma once
+
+#include "imgui.h"      // IMGUI_API, ImGuiIO, ImVector
+
+// Input state, used to compute differences between frames
+struct ImGuiInputRecordState
+{
+    float   DeltaTime;
+    ImVec2  DisplaySize;
+    ImVec2  DisplayFramebufferScale;
+    ImVec2  MousePos;
+    bool    MouseDown[5];
+    bool    KeyCtrl, KeyShift, KeyAlt, KeySuper;
+    bool    KeysDown[512];
+    float   NavInputs[ImGuiNavInput_COUNT];
+
+    ImGuiInputRecordState();
+};
+
+struct IMGUI_API ImGuiInputRecorder
+{
+    ImVector<unsigned char> Data;           // Header + encoded frames
+    int                     FramesCount;
+    ImGuiInputRecordState   PrevState;
+
+    ImGuiInputRecorder()    { Clear(); }
+    void                    Clear();
+    void                    RecordFrame(const ImGuiIO& io);
+    bool                    SaveToFile(const char* filename);
+};
+
+struct IMGUI_API ImGuiInputReplayer
+{
+    ImVector<unsigned char> Data;
+    int                     FramesCount;    // Number of frames in Data
+    int                     FrameIdx;       // Next frame to replay
+    int                     DataPos;        // Read position of the next frame in Data
+    ImGuiInputRecordState   State;
+
+    ImGuiInputReplayer()    { Data.clear(); FramesCount = 0; Rewind(); }
+    bool                    LoadFromMemory(const void* data, size_t data_size);   // Return false if the data is not a valid record
+    bool                    LoadFromFile(const char* filename);
+    void                    Rewind();
+    bool                    ReplayFrame(ImGuiIO& io);                            // Return false when there is no more frame to replay (io is left untouched)
+};